@@ -0,0 +1,345 @@
+/**
+ * @file bench.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "src/bus.h"
+#include "src/bus_fleet.h"
+#include "src/config_manager.h"
+#include "src/configuration_simulator.h"
+#include "src/event_simulator.h"
+#include "src/passenger_generator.h"
+#include "src/passenger_pool.h"
+#include "src/random_passenger_generator.h"
+#include "src/route.h"
+#include "src/stop.h"
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+// each case reports the median of this many timed runs
+static const int kRepetitions = 5;
+// every run is the same, so numbers compare between builds
+static const unsigned int kSeed = 3081;
+
+// what a case's body adds up: only the work between Start() and Stop()
+class Timing {
+ public:
+  Timing() : seconds_(0), ops_(0) {}
+  void Start() { start_ = std::chrono::steady_clock::now(); }
+  void Stop(int64_t ops) {
+    seconds_ += std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start_).count();
+    ops_ += ops;
+  }
+  double GetSeconds() const { return seconds_; }
+  int64_t GetOps() const { return ops_; }
+
+ private:
+  std::chrono::steady_clock::time_point start_;
+  double seconds_;
+  int64_t ops_;
+};
+
+static std::string filter;  // only cases whose name contains this run
+static double min_seconds = 0.1;  // timed time per run
+static volatile double sink;  // keeps results of read-only loops alive
+
+// runs the body until min_seconds are timed, kRepetitions times over,
+// and prints the median time per op
+static void Measure(const std::string& name, int param,
+                    std::function<void(Timing *)> body) {
+  std::vector<double> ns_per_op;
+  int64_t ops = 0;
+  Timing warm_up;  // fills caches and the passenger pool, not reported
+  body(&warm_up);
+  for (int run = 0; run < kRepetitions; run++) {
+    Timing timing;
+    while (timing.GetSeconds() < min_seconds) {
+      body(&timing);
+    }
+    ns_per_op.push_back(timing.GetSeconds() * 1e9 / timing.GetOps());
+    ops = std::max(ops, timing.GetOps());
+  }
+  std::sort(ns_per_op.begin(), ns_per_op.end());
+  printf("%-58s %8d %12lld %12.1f\n", name.c_str(), param,
+         static_cast<long long>(ops), ns_per_op[kRepetitions / 2]);
+}
+
+static bool Selected(const std::string& name) {
+  return name.find(filter) != std::string::npos;
+}
+
+// a straight line of stops a fixed distance apart; stops and generator
+// live as long as the benchmark, like a config's do
+static Route * MakeRoute(const std::string& name, int num_stops,
+                         double probability) {
+  std::vector<Stop *> stops;
+  std::vector<double> distances(num_stops - 1, 5);
+  std::list<Stop *> stop_list;
+  std::list<double> probabilities;
+  for (int i = 0; i < num_stops; i++) {
+    stops.push_back(new Stop(i, 44.97 + i * .001, -93.23));
+    stop_list.push_back(stops.back());
+    probabilities.push_back(i < num_stops - 1 ? probability : 0);
+  }
+  return new Route(name, &stops[0], &distances[0], num_stops,
+                   new RandomPassengerGenerator(probabilities, stop_list));
+}
+
+// loads everyone waiting along a route onto a bus that is then reclaimed
+static void DrainRoute(Route * route) {
+  Route * walk = route->Clone();
+  Bus drain("drain", route->Clone(), route->Clone(), INT_MAX, 1);
+  while (!walk->IsAtEnd()) {
+    walk->GetDestinationStop()->LoadPassengers(&drain,
+                                               walk->GetDestinationQueue());
+    walk->NextStop();
+  }
+  drain.Reclaim();
+  delete walk;
+}
+
+// two routes of num_stops stops each, in the format ConfigManager reads
+static void WriteConfig(const std::string& filename, int num_stops,
+                        double probability = .1) {
+  std::ofstream out("config/" + filename);
+  out << "ROUTE_GENERAL, Bench\n\n";
+  for (int route = 0; route < 2; route++) {
+    out << "ROUTE, " << (route == 0 ? "Out" : "In") << "\n\n";
+    for (int i = 0; i < num_stops; i++) {
+      int position = route == 0 ? i : num_stops - 1 - i;
+      out << "STOP, Stop " << position << ", " << 44.97 + position * .001
+          << ", -93.23, " << (i < num_stops - 1 ? probability : 0) << "\n";
+    }
+    out << "\n";
+  }
+}
+
+/*******************************************************************************
+ * Benchmarks
+ ******************************************************************************/
+// one Move() per call, through empty stops, for a whole round trip
+static void BenchBusMove(int num_stops) {
+  Route * out = MakeRoute("Out", num_stops, 0);
+  Route * in = MakeRoute("In", num_stops, 0);
+  Measure("Bus::Move/stops", num_stops, [&](Timing * timing) {
+    Bus * bus = new Bus("bench", out->Clone(), in->Clone(), 60, 1);
+    int64_t moves = 0;
+    timing->Start();
+    while (bus->Move()) {
+      moves++;
+    }
+    timing->Stop(moves);
+    bus->Reclaim();
+    delete bus;
+  });
+}
+
+// one bus moved one step per op, the way ConfigurationSimulator moves them
+static void BenchFleetAdvance(int num_busses) {
+  Route * out = MakeRoute("Out", 50, 0);
+  Route * in = MakeRoute("In", 50, 0);
+  Measure("BusFleet::Advance+VisitStops/fleet", num_busses,
+          [&](Timing * timing) {
+    BusFleet fleet;
+    for (int i = 0; i < num_busses; i++) {
+      // spread speeds so busses reach stops on different steps
+      fleet.Add(new Bus(std::to_string(i), out->Clone(), in->Clone(), 60,
+                        1 + (i % 4) * .25));
+    }
+    int64_t moves = 0;
+    timing->Start();
+    while (fleet.GetNumBusses() > 0) {
+      moves += fleet.GetNumBusses();
+      fleet.Advance();
+      fleet.VisitStops();
+      fleet.RemoveCompleted();
+    }
+    timing->Stop(moves);
+  });
+}
+
+// queue_depth passengers boarding one empty bus, per passenger
+static void BenchLoadPassengers(int queue_depth) {
+  Route * route = MakeRoute("Load", 2, 0);
+  Stop * stop = route->GetStops()[0];
+  Stop * destination = route->GetStops()[1];
+  Measure("Stop::LoadPassengers/queue", queue_depth, [&](Timing * timing) {
+    Bus bus("bench", route->Clone(), route->Clone(), queue_depth, 1);
+    for (int i = 0; i < queue_depth; i++) {
+      stop->AddPassengers(PassengerPool::Acquire(destination->GetId(), 0));
+    }
+    timing->Start();
+    stop->LoadPassengers(&bus);
+    timing->Stop(queue_depth);
+    bus.Reclaim();
+  });
+}
+
+// queue_depth riders leaving at one stop, per passenger
+static void BenchUnloadPassengers(int queue_depth) {
+  Route * route = MakeRoute("Unload", 2, 0);
+  Stop * destination = route->GetStops()[1];
+  Measure("Bus::UnloadPassengers/queue", queue_depth, [&](Timing * timing) {
+    Bus bus("bench", route->Clone(), route->Clone(), queue_depth, 1);
+    for (int i = 0; i < queue_depth; i++) {
+      bus.LoadPassenger(PassengerPool::Acquire(destination->GetId(), 0));
+    }
+    timing->Start();
+    bus.UnloadPassengers(destination);
+    timing->Stop(queue_depth);
+    bus.Reclaim();
+  });
+}
+
+// walking a cloned route end to end, per stop
+static void BenchRouteNextStop(int num_stops) {
+  Route * route = MakeRoute("Walk", num_stops, 0);
+  Measure("Route::NextStop+GetNextStopDistance/stops", num_stops,
+          [&](Timing * timing) {
+    Route * walk = route->Clone();
+    double total = 0;
+    timing->Start();
+    while (!walk->IsAtEnd()) {
+      total += walk->GetNextStopDistance();
+      walk->NextStop();
+    }
+    timing->Stop(num_stops);
+    sink = total;
+    delete walk;
+  });
+}
+
+// one time step of arrivals along a route, per stop
+static void BenchGeneratePassengers(int num_stops, bool batch) {
+  RandomPassengerGenerator::SetMasterSeed(kSeed);
+  RandomPassengerGenerator::SetBatchSampling(batch);
+  Route * route = MakeRoute("Generate", num_stops, .3);
+  Measure(batch ? "RandomPassengerGenerator::GeneratePassengers(batch)/stops"
+                : "RandomPassengerGenerator::GeneratePassengers/stops",
+          num_stops, [&](Timing * timing) {
+    timing->Start();
+    route->GenerateNewPassengers();
+    timing->Stop(num_stops);
+    DrainRoute(route);
+  });
+  RandomPassengerGenerator::SetBatchSampling(false);
+}
+
+// parsing a whole config file, per stop in it
+static void BenchReadConfig(int num_stops) {
+  std::string filename = "bench_" + std::to_string(num_stops) + ".txt";
+  WriteConfig(filename, num_stops);
+  Measure("ConfigManager::ReadConfig/stops", num_stops,
+          [&](Timing * timing) {
+    ConfigManager cm;
+    timing->Start();
+    cm.ReadConfig(filename);
+    timing->Stop(2 * num_stops);
+  });
+  std::remove(("config/" + filename).c_str());
+}
+
+// time steps of a network where a passenger arrives at each stop about once
+// in a thousand steps and a bus leaves every thousand, per step; the tick
+// engine visits every stop each step, the event engine only what happens
+static void BenchSparseNetwork(int num_stops, bool events) {
+  const int kSteps = 2000;
+  std::string filename = "bench_sparse_" + std::to_string(num_stops) + ".txt";
+  WriteConfig(filename, num_stops, .001);
+  std::vector<int> intervals(1, 1000);
+  Measure(events ? "EventSimulator::RunUntil(sparse)/stops"
+                 : "ConfigurationSimulator::Update(sparse)/stops",
+          num_stops, [&](Timing * timing) {
+    RandomPassengerGenerator::SetMasterSeed(kSeed);
+    ConfigManager cm;
+    cm.ReadConfig(filename);
+    if (events) {
+      EventSimulator sim(&cm);
+      sim.SetReportLevel(kReportNone);
+      sim.Start(intervals, kSteps);
+      timing->Start();
+      sim.RunUntil(kSteps);
+      timing->Stop(kSteps);
+    } else {
+      ConfigurationSimulator sim(&cm);
+      sim.SetReportLevel(kReportNone);
+      sim.Start(intervals, kSteps);
+      timing->Start();
+      for (int i = 0; i < kSteps; i++) {
+        sim.Update();
+      }
+      timing->Stop(kSteps);
+    }
+  });
+  std::remove(("config/" + filename).c_str());
+}
+
+int main(int argc, char* argv[]) {
+  if (argc > 3) {
+    std::cout << "Usage: ./build/bin/bench [name_filter] [min_seconds]";
+    std::cout << std::endl;
+    std::cout << "Run from the project directory, ReadConfig cases write ";
+    std::cout << "their files to config/." << std::endl;
+    return 1;
+  }
+  if (argc > 1) {
+    filter = argv[1];
+  }
+  if (argc > 2) {
+    min_seconds = atof(argv[2]);
+  }
+
+  // generators would otherwise announce every call
+  PassengerGenerator::SetReportLevel(kReportNone);
+  printf("%-58s %8s %12s %12s\n", "Benchmark", "Param", "Ops", "ns/op");
+  const int stop_counts[] = {10, 100, 1000};
+  const int fleet_sizes[] = {1, 10, 100, 1000};
+  const int queue_depths[] = {1, 10, 100, 1000};
+
+  for (int n : stop_counts) {
+    if (Selected("Bus::Move")) BenchBusMove(n);
+  }
+  for (int n : fleet_sizes) {
+    if (Selected("BusFleet::Advance")) BenchFleetAdvance(n);
+  }
+  for (int n : queue_depths) {
+    if (Selected("Stop::LoadPassengers")) BenchLoadPassengers(n);
+  }
+  for (int n : queue_depths) {
+    if (Selected("Bus::UnloadPassengers")) BenchUnloadPassengers(n);
+  }
+  for (int n : stop_counts) {
+    if (Selected("Route::NextStop")) BenchRouteNextStop(n);
+  }
+  for (int n : stop_counts) {
+    if (Selected("RandomPassengerGenerator")) {
+      BenchGeneratePassengers(n, false);
+      BenchGeneratePassengers(n, true);
+    }
+  }
+  for (int n : stop_counts) {
+    if (Selected("ConfigManager::ReadConfig")) BenchReadConfig(n);
+  }
+  for (int n : stop_counts) {
+    if (Selected("(sparse)")) {
+      BenchSparseNetwork(n, false);
+      BenchSparseNetwork(n, true);
+    }
+  }
+  return 0;
+}
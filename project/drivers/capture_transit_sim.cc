@@ -6,8 +6,19 @@
 #include <ctime>
 #include <iostream>
 #include <random>
+#include <string>
 
 #include "src/local_simulator.h"
+#include "src/trace_writer.h"
+
+// banners go into the trace when capturing so trace_reader prints them too
+static void Banner(const std::string& text, TraceWriter * trace) {
+  if (trace) {
+    trace->WriteText(text);
+  } else {
+    std::cout << text;
+  }
+}
 
 int main(int argc, char* argv[]) {
   int rounds = 50;  // Number of rounds of generation to simulate in test
@@ -15,35 +26,44 @@ int main(int argc, char* argv[]) {
   srand((long)time(NULL));  // Seed the random number generator...
 
   LocalSimulator my_sim;
+  TraceWriter * trace = NULL;
 
+  // with a file name the run is captured as a binary trace instead of text,
+  // convert it back with ./build/bin/trace_reader <file>
   if (argc == 2) {
-    freopen(argv[1], "w", stdout);
+    trace = new TraceWriter(argv[1]);
+    if (!trace->IsOpen()) {
+      std::cout << "Could not open " << argv[1] << std::endl;
+      delete trace;
+      return 1;
+    }
+    my_sim.SetReportLevel(kReportNone);
+    my_sim.SetTrace(trace);
   }
 
-  std::cout << "/*************************" << std::endl << std::endl;
-  std::cout << "         STARTING" << std::endl;
-  std::cout << "        SIMULATION" << std::endl;
-  std::cout << "*************************/" << std::endl;
+  Banner("/*************************\n\n"
+         "         STARTING\n"
+         "        SIMULATION\n"
+         "*************************/\n", trace);
 
   my_sim.Start();
 
-  std::cout << "/*************************" << std::endl << std::endl;
-  std::cout << "           BEGIN" << std::endl;
-  std::cout << "          UPDATING" << std::endl;
-  std::cout << "*************************/" << std::endl;
+  Banner("/*************************\n\n"
+         "           BEGIN\n"
+         "          UPDATING\n"
+         "*************************/\n", trace);
 
   for (int i = 0; i < rounds; i++) {
     my_sim.Update();
   }
 
-  std::cout << "/*************************" << std::endl << std::endl;
-  std::cout << "        SIMULATION" << std::endl;
-  std::cout << "         COMPLETE" << std::endl;
-  std::cout << "*************************/" << std::endl;
+  Banner("/*************************\n\n"
+         "        SIMULATION\n"
+         "         COMPLETE\n"
+         "*************************/\n", trace);
 
-  if (argc == 2) {
-    fclose(stdout);
-  }
+  // flushes the last buffered records
+  delete trace;
 
   return 0;
 }
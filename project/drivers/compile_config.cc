@@ -0,0 +1,34 @@
+/**
+ * @file compile_config.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+#include <iostream>
+
+#include "src/config_manager.h"
+
+int main(int argc, char* argv[]) {
+  if (argc != 3) {
+    std::cout << "Usage: ./build/bin/compile_config <config_filename> ";
+    std::cout << "<snapshot_filename>" << std::endl;
+    std::cout << "Both files live in the config directory, pass the ";
+    std::cout << "snapshot to config_sim in place of the config file.";
+    std::cout << std::endl;
+    return 1;
+  }
+
+  ConfigManager cm;
+  // malformed rows are reported but do not stop the rest from compiling
+  if (!cm.ReadConfig(argv[1]) && cm.GetRoutes().empty()) {
+    return 1;
+  }
+  if (!cm.WriteSnapshot(argv[2])) {
+    std::cerr << "Could not write config/" << argv[2] << std::endl;
+    return 1;
+  }
+
+  std::cout << "Compiled " << cm.GetStops().size() << " stops and ";
+  std::cout << cm.GetRoutes().size() << " routes into config/" << argv[2];
+  std::cout << std::endl;
+  return 0;
+}
@@ -6,9 +6,12 @@
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <string>
 
 #include "src/config_manager.h"
 #include "src/configuration_simulator.h"
+#include "src/event_simulator.h"
+#include "src/random_passenger_generator.h"
 
 int main(int argc, char**argv) {
   // NOTE: this usage will change depending on
@@ -24,21 +27,42 @@ int main(int argc, char**argv) {
   std::cout << "Usage: ./build/bin/configuration_sim <config_filename> ";
   std::cout << "<rounds> <bus_interval>";
   std::cout << std::endl;
+  std::cout << "Usage: ./build/bin/configuration_sim <config_filename> ";
+  std::cout << "<rounds> <bus_interval> <seed>";
+  std::cout << std::endl;
+  std::cout << "Usage: ./build/bin/configuration_sim <config_filename> ";
+  std::cout << "<rounds> <bus_interval> <seed> <none|summary|full>";
+  std::cout << std::endl;
+  std::cout << "Usage: ./build/bin/configuration_sim <config_filename> ";
+  std::cout << "<rounds> <bus_interval> <seed> <none|summary|full> ";
+  std::cout << "<tick|event>";
+  std::cout << std::endl;
+  std::cout << "Usage: ./build/bin/configuration_sim <config_filename> ";
+  std::cout << "<rounds> <bus_interval> <seed> <none|summary|full> ";
+  std::cout << "<tick|event> <trials|batch>";
+  std::cout << std::endl;
 
   //   Create ConfigManager
   ConfigManager* cm = new ConfigManager();
   int rounds = 25;
   int interval = 5;
+  ReportLevel report_level = kReportFull;
+  bool use_events = false;
   ConfigurationSimulator* cs;
 
+  // generators are seeded as the config is read, so the seed comes first
+  if (argc >= 5) {
+    RandomPassengerGenerator::SetMasterSeed(std::atoi(argv[4]));
+  }
+
   // Check command line params for config file name
   // only one arg means no parameters used, use default file
   if (argc == 1) {
     cm->ReadConfig("config.txt");
     std::cout << "Using default config file." << std::endl;
 
-    // limit to 4 parameters
-  } else if (argc > 1 && argc < 5) {
+    // limit to 8 parameters
+  } else if (argc > 1 && argc < 9) {
     if (argc > 1) {
       // if file doesn't exist, print errors and use default config file
       if (!(std::ifstream("config/" + std::string(argv[1])))) {
@@ -58,6 +82,25 @@ int main(int argc, char**argv) {
       // fourth arg read as bus interval
       interval = std::atoi(argv[3]);
     }
+    if (argc > 5) {
+      // sixth arg read as report level, anything unknown keeps full output
+      std::string level = argv[5];
+      if (level == "none") {
+        report_level = kReportNone;
+      } else if (level == "summary") {
+        report_level = kReportSummary;
+      }
+    }
+    if (argc > 6) {
+      // seventh arg picks the engine, the tick engine unless "event"
+      use_events = (std::string(argv[6]) == "event");
+    }
+    if (argc > 7) {
+      // eighth arg picks how arrivals are drawn, one draw per stop for
+      // "batch", otherwise the trial loop
+      RandomPassengerGenerator::SetBatchSampling(
+          std::string(argv[7]) == "batch");
+    }
     // incorrect number of args will produce incorrect format response
   } else {
     std::cout << "Not the correct format. Refer to correct format usage.";
@@ -78,9 +121,6 @@ int main(int argc, char**argv) {
     return 0;
   }
 
-  //   Create ConfigurationSimulator
-  cs = new ConfigurationSimulator(cm);
-
   std::cout << "/*************************" << std::endl << std::endl;
   std::cout << "         STARTING" << std::endl;
   std::cout << "        SIMULATION" << std::endl;
@@ -90,6 +130,25 @@ int main(int argc, char**argv) {
   std::vector<int> interval_vec;
   interval_vec.push_back(interval);
 
+  // the event engine only reports once, after the last step
+  if (use_events) {
+    EventSimulator* es = new EventSimulator(cm);
+    es->SetReportLevel(report_level);
+    es->Start(interval_vec, rounds);
+    es->Run();
+    delete es;
+
+    std::cout << "/*************************" << std::endl << std::endl;
+    std::cout << "        SIMULATION" << std::endl;
+    std::cout << "         COMPLETE" << std::endl;
+    std::cout << "*************************/" << std::endl;
+    return 0;
+  }
+
+  //   Create ConfigurationSimulator
+  cs = new ConfigurationSimulator(cm);
+  cs->SetReportLevel(report_level);
+
   //   Call Start on ConfigurationSimulator
   cs->Start(interval_vec, rounds);
 
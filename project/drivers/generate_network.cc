@@ -0,0 +1,50 @@
+/**
+ * @file generate_network.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+#include <cstdlib>
+#include <iostream>
+
+#include "src/network_generator.h"
+
+int main(int argc, char* argv[]) {
+  if (argc < 4 || argc > 8) {
+    std::cout << "Usage: ./build/bin/generate_network <config_filename> ";
+    std::cout << "<lines> <stops_per_route> [transfer_every] ";
+    std::cout << "[min_probability] [max_probability] [seed]" << std::endl;
+    std::cout << "Each line is an outbound and an inbound route, ";
+    std::cout << "the file is written to the config directory." << std::endl;
+    return 1;
+  }
+
+  NetworkShape shape;
+  shape.num_lines = std::atoi(argv[2]);
+  shape.num_stops = std::atoi(argv[3]);
+  if (argc > 4) {
+    shape.transfer_every = std::atoi(argv[4]);
+  }
+  if (argc > 5) {
+    shape.min_probability = std::atof(argv[5]);
+  }
+  if (argc > 6) {
+    shape.max_probability = std::atof(argv[6]);
+  }
+  if (argc > 7) {
+    shape.seed = std::atoi(argv[7]);
+  }
+  if (shape.num_lines < 1 || shape.num_stops < 2) {
+    std::cout << "Please input at least 1 line and 2 stops per route.";
+    std::cout << std::endl;
+    return 1;
+  }
+
+  if (!NetworkGenerator::Write(argv[1], shape)) {
+    std::cerr << "Could not write config/" << argv[1] << std::endl;
+    return 1;
+  }
+  std::cout << "Wrote " << 2 * shape.num_lines << " routes of ";
+  std::cout << shape.num_stops << " stops to config/" << argv[1];
+  std::cout << std::endl;
+  return 0;
+}
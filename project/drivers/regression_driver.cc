@@ -5,8 +5,12 @@
 #include <string>
 
 #include "r_local_simulator.h"
+#include "trace_writer.h"
 
-int main() {
+// ./build/bin/regression_test [trace_file]
+// with a trace file the run is recorded in binary, so two runs can be
+// compared with cmp and only converted with trace_reader when they differ
+int main(int argc, char* argv[]) {
 
   int rounds = 50; //Number of rounds of generation to simulate in test
   
@@ -14,6 +18,17 @@ int main() {
 
 
   rLocalSimulator my_sim;
+  TraceWriter * trace = NULL;
+  if (argc == 2) {
+    trace = new TraceWriter(argv[1]);
+    if (!trace->IsOpen()) {
+      std::cout << "Could not open " << argv[1] << std::endl;
+      delete trace;
+      return 1;
+    }
+    my_sim.SetReportLevel(kReportNone);
+    my_sim.SetTrace(trace);
+  }
   
   std::cout << "/*************************" << std::endl << std::endl;
   std::cout << "         STARTING" << std::endl;
@@ -36,6 +51,7 @@ int main() {
   std::cout << "         COMPLETE" << std::endl;
   std::cout << "*************************/" << std::endl;
   
+  delete trace;
 
   return 0;
 }
@@ -0,0 +1,45 @@
+/**
+ * @file sweep_sim.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include "src/sweep_runner.h"
+
+int main(int argc, char* argv[]) {
+  if (argc < 2 || argc > 4) {
+    std::cout << "Usage: ./build/bin/sweep_sim <grid_filename> [threads] ";
+    std::cout << "[output_csv]" << std::endl;
+    std::cout << "The grid lives in the config directory, one row each of ";
+    std::cout << "CONFIG, INTERVAL, CAPACITY, SPEED, SEED and ROUNDS ";
+    std::cout << "values, for example:" << std::endl;
+    std::cout << "  CONFIG, config.txt" << std::endl;
+    std::cout << "  INTERVAL, 5, 10, 3/8" << std::endl;
+    std::cout << "  SEED, 1, 2, 3" << std::endl;
+    std::cout << "One KPI row per scenario goes to the CSV, or to the ";
+    std::cout << "screen if none is named. Threads default to one per core.";
+    std::cout << std::endl;
+    return 1;
+  }
+
+  SweepRunner runner;
+  if (!runner.ReadGrid(argv[1])) {
+    return 1;
+  }
+  int threads = argc > 2 ? std::atoi(argv[2]) : 0;
+
+  std::ofstream file;
+  if (argc > 3) {
+    file.open(argv[3]);
+    if (!file) {
+      std::cerr << "Could not write " << argv[3] << std::endl;
+      return 1;
+    }
+  }
+  std::cerr << "Running " << runner.GetScenarios().size() << " scenarios";
+  std::cerr << std::endl;
+  return runner.Run(argc > 3 ? file : std::cout, threads) ? 0 : 1;
+}
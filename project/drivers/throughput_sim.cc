@@ -0,0 +1,107 @@
+/**
+ * @file throughput_sim.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+#include <sys/resource.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "src/config_manager.h"
+#include "src/configuration_simulator.h"
+#include "src/phase_profiler.h"
+#include "src/random_passenger_generator.h"
+#include "src/service_kpis.h"
+
+// seconds since start, from a clock that never jumps
+static double SecondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(
+             std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+  if (argc < 3 || argc > 7) {
+    std::cout << "Usage: ./build/bin/throughput_sim <config_filename> ";
+    std::cout << "<rounds> [bus_interval] [seed] [none|profile|kpis|both] ";
+    std::cout << "[csv_filename]" << std::endl;
+    std::cout << "Runs ConfigurationSimulator with no output and reports ";
+    std::cout << "its speed, every route pair uses the same interval.";
+    std::cout << std::endl;
+    std::cout << "With profile, also reports time and counts per phase of ";
+    std::cout << "Update(), and writes them per tick to the CSV if named.";
+    std::cout << std::endl;
+    std::cout << "With kpis, also reports waits, rides, bus loads and ";
+    std::cout << "denied boardings." << std::endl;
+    return 1;
+  }
+  int rounds = std::atoi(argv[2]);
+  int interval = argc > 3 ? std::atoi(argv[3]) : 5;
+  RandomPassengerGenerator::SetMasterSeed(argc > 4 ? std::atoi(argv[4]) : 1);
+  if (rounds <= 0 || interval <= 0) {
+    std::cout << "Please input integers greater than 0 for rounds and ";
+    std::cout << "bus_interval." << std::endl;
+    return 1;
+  }
+
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  ConfigManager cm;
+  if (!cm.ReadConfig(argv[1]) && cm.GetRoutes().empty()) {
+    return 1;
+  }
+  double read_seconds = SecondsSince(start);
+
+  ConfigurationSimulator cs(&cm);
+  cs.SetReportLevel(kReportNone);
+  PhaseProfiler profiler;
+  std::ofstream csv;
+  std::string extras = argc > 5 ? argv[5] : "none";
+  bool profile = (extras == "profile" || extras == "both");
+  ServiceKpis kpis;
+  if (extras == "kpis" || extras == "both") {
+    cs.SetKpis(&kpis);
+  }
+  if (profile) {
+    cs.SetProfiler(&profiler);
+    if (argc > 6) {
+      csv.open(argv[6]);
+      profiler.SetCsv(&csv);
+    }
+  }
+  std::vector<int> intervals(cm.GetRoutes().size() / 2, interval);
+
+  start = std::chrono::steady_clock::now();
+  cs.Start(intervals, rounds);
+  for (int i = 0; i < rounds; i++) {
+    cs.Update();
+  }
+  double run_seconds = SecondsSince(start);
+
+  // ru_maxrss is in kilobytes on Linux
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+
+  std::cout << "Network: " << cm.GetRoutes().size() << " routes, ";
+  std::cout << cm.GetStops().size() << " stops" << std::endl;
+  std::cout << "Config read in " << read_seconds << " s" << std::endl;
+  std::cout << "Simulated " << rounds << " steps in " << run_seconds;
+  std::cout << " s" << std::endl;
+  std::cout << "Ticks/sec: " << rounds / run_seconds << std::endl;
+  std::cout << "Passengers generated: " << cs.GetNumGenerated() << std::endl;
+  std::cout << "Passengers/sec: " << cs.GetNumGenerated() / run_seconds;
+  std::cout << std::endl;
+  std::cout << "Busses running at end: " << cs.GetNumBusses() << std::endl;
+  std::cout << "Peak RSS: " << usage.ru_maxrss << " KB" << std::endl;
+  if (profile) {
+    profiler.ReportSummary(std::cout);
+  }
+  if (extras == "kpis" || extras == "both") {
+    kpis.ReportSummary(std::cout, cm.GetStops());
+  }
+  return 0;
+}
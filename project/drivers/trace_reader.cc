@@ -0,0 +1,22 @@
+/**
+ * @file trace_reader.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+#include <iostream>
+
+#include "src/trace_reader.h"
+
+int main(int argc, char* argv[]) {
+  if (argc != 2) {
+    std::cout << "Usage: ./build/bin/trace_reader <trace_file>" << std::endl;
+    return 1;
+  }
+
+  // text goes to stdout, redirect it to compare against an old capture
+  if (!TraceReader::ToText(argv[1], std::cout)) {
+    std::cerr << "Could not read trace " << argv[1] << std::endl;
+    return 1;
+  }
+  return 0;
+}
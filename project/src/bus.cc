@@ -9,6 +9,10 @@
 ******************************************************************************/
 #include "src/bus.h"
 
+#include "src/passenger_pool.h"
+#include "src/service_kpis.h"
+#include "src/trace_writer.h"
+
 Bus::Bus(std::string name, Route * out, Route * in,
          int capacity, double speed) {
   name_ = name;
@@ -16,16 +20,44 @@ Bus::Bus(std::string name, Route * out, Route * in,
   incoming_route_ = in;
   passenger_max_capacity_ = capacity;
   speed_ = speed;
+  num_passengers_ = 0;
+  num_boarded_ = 0;
+  num_alighted_ = 0;
+  load_sum_ = 0;
+  num_departures_ = 0;
+  kpis_ = NULL;
+  pending_stop_ = false;
+  clock_ = 0;
+  rider_clock_ = &clock_;
   distance_remaining_ = out->GetNextStopDistance();
+  segment_ = &out->GetSegment();
+
+  // outgoing visits are numbered first, a bus starting at its end is on the
+  // incoming route already
+  next_visit_ = out->IsAtEnd() ? static_cast<int>(out->GetStops().size()) : 0;
 }
 
-// add passenger to list given a new passenger
+// add passenger to the bucket for its destination stop
 bool Bus::LoadPassenger(Passenger * new_passenger) {
   // check that there's space on bus
-  if (passengers_.size() < (unsigned)passenger_max_capacity_) {
-    // add passenger to the back of list and set flag that passenger is on bus
-    passengers_.push_back(new_passenger);
+  if (num_passengers_ < passenger_max_capacity_) {
+    // add passenger to the back of bucket and set flag that passenger is on bus
+    int bucket = BucketFor(new_passenger->GetDestination());
+    if (bucket < 0) {
+      stranded_.push_back(new_passenger);
+    } else {
+      if (bucket >= static_cast<int>(passengers_.size())) {
+        passengers_.resize(bucket + 1);
+      }
+      passengers_[bucket].push_back(new_passenger);
+    }
+    num_passengers_++;
+    num_boarded_++;
+    new_passenger->SetClock(rider_clock_);
     new_passenger->GetOnBus();
+    if (kpis_ != NULL) {
+      kpis_->RecordBoarding(new_passenger->GetWaitAtStop());
+    }
     return true;
   }
   return false;
@@ -40,32 +72,7 @@ bool Bus::Move() {
   }
   // if we have reached the next stop
   if (distance_remaining_ <= 0) {
-    // if we are currently on the outgoing route
-    if (!outgoing_route_->IsAtEnd()) {
-      Stop* destination_ = outgoing_route_->GetDestinationStop();
-      // if there are no passengers to load or unload at this stop
-      outgoing_route_->NextStop();
-      if (!(UnloadPassengers(destination_) ||
-          destination_->LoadPassengers(this))) {
-        // no passengers unloaded/loaded means move past current
-        // and we subtract the distance we already travelled past
-        distance_remaining_ += outgoing_route_->GetNextStopDistance();
-      } else {
-        // passengers to unload/load so we stop and set distance to next stop
-        distance_remaining_ = outgoing_route_->GetNextStopDistance();
-      }
-    } else {
-      // equivalent responses if we are on the outgoing route
-      Stop* destination_ = incoming_route_->GetDestinationStop();
-      incoming_route_->NextStop();
-      if (!(UnloadPassengers(destination_) ||
-           destination_->LoadPassengers(this))) {
-        distance_remaining_ += incoming_route_->GetNextStopDistance();
-      } else {
-        distance_remaining_ = incoming_route_->GetNextStopDistance();
-      }
-    // set distance_remaining to distance till next stop
-    }
+    VisitStop();
     // move towards next stop if we are not at a stop
   } else {
     distance_remaining_ -= speed_;
@@ -73,21 +80,130 @@ bool Bus::Move() {
   return true;
 }
 
+// unload/load at the stop just reached and head for the next one
+void Bus::VisitStop() {
+  // riders leaving here are all in this visit's bucket
+  int visit = next_visit_;
+  // if we are currently on the outgoing route
+  if (!outgoing_route_->IsAtEnd()) {
+    Stop* destination_ = outgoing_route_->GetDestinationStop();
+    int queue = outgoing_route_->GetDestinationQueue();
+    // if there are no passengers to load or unload at this stop
+    outgoing_route_->NextStop();
+    next_visit_ = outgoing_route_->IsAtEnd()
+        ? static_cast<int>(outgoing_route_->GetStops().size()) : visit + 1;
+    if (!(UnloadVisit(visit, destination_->GetId()) ||
+        destination_->LoadPassengers(this, queue))) {
+      // no passengers unloaded/loaded means move past current
+      // and we subtract the distance we already travelled past
+      distance_remaining_ += outgoing_route_->GetNextStopDistance();
+    } else {
+      // passengers to unload/load so we stop and set distance to next stop
+      distance_remaining_ = outgoing_route_->GetNextStopDistance();
+    }
+  } else {
+    // equivalent responses if we are on the outgoing route
+    Stop* destination_ = incoming_route_->GetDestinationStop();
+    int queue = incoming_route_->GetDestinationQueue();
+    incoming_route_->NextStop();
+    next_visit_ = visit + 1;
+    if (!(UnloadVisit(visit, destination_->GetId()) ||
+         destination_->LoadPassengers(this, queue))) {
+      distance_remaining_ += incoming_route_->GetNextStopDistance();
+    } else {
+      distance_remaining_ = incoming_route_->GetNextStopDistance();
+    }
+  // set distance_remaining to distance till next stop
+  }
+  if (passenger_max_capacity_ > 0) {
+    load_sum_ += static_cast<double>(num_passengers_) / passenger_max_capacity_;
+  }
+  num_departures_++;
+  // the leg changes only here, so its geometry is looked up once per stop
+  if (!outgoing_route_->IsAtEnd()) {
+    segment_ = &outgoing_route_->GetSegment();
+  } else {
+    segment_ = &incoming_route_->GetSegment();
+  }
+}
+
 // Method to unload passengers if passenger destination ID matches stop ID
+// everyone getting off at a visit shares its bucket, so only the next visit
+// to this stop and the riders with no stop ahead are looked at
 bool Bus::UnloadPassengers(Stop * curr_stop) {
-  bool unloaded = false;
-  for (std::list<Passenger *>::iterator it = passengers_.begin();
-       it != passengers_.end(); it++) {
-    // Check if Passenger ID matches current stop ID
-    if ((*it)->GetDestination() == curr_stop->GetId()) {
-      passengers_.remove(*it);
-      --it;
-      unloaded = true;
-    }
+  int destination = curr_stop->GetId();
+  bool unloaded = UnloadVisit(BucketFor(destination), destination);
+  if (!stranded_.empty()) {
+    unloaded = UnloadBucket(&stranded_, destination) || unloaded;
   }
   return unloaded;
 }
 
+// each route finds its own visit in its shared topology
+int Bus::BucketFor(int destination) const {
+  int num_out = static_cast<int>(outgoing_route_->GetStops().size());
+  if (next_visit_ < num_out) {
+    int visit = outgoing_route_->FindVisit(destination, next_visit_);
+    if (visit >= 0) {
+      return visit;
+    }
+  }
+  int visit = incoming_route_->FindVisit(destination,
+      next_visit_ > num_out ? next_visit_ - num_out : 0);
+  return visit >= 0 ? num_out + visit : -1;
+}
+
+bool Bus::UnloadVisit(int visit, int destination) {
+  if (visit < 0 || visit >= static_cast<int>(passengers_.size())) {
+    return false;
+  }
+  return UnloadBucket(&passengers_[visit], destination);
+}
+
+// the passengers go back to the pool since they leave the simulation, and the
+// bucket keeps its storage for the next boarding
+bool Bus::UnloadBucket(std::vector<Passenger *> * riders, int destination) {
+  int kept = 0;
+  for (int i = 0; i < static_cast<int>(riders->size()); i++) {
+    // only stranded riders mix destinations
+    if ((*riders)[i]->GetDestination() != destination) {
+      (*riders)[kept++] = (*riders)[i];
+      continue;
+    }
+    if (kpis_ != NULL) {
+      kpis_->RecordAlighting((*riders)[i]->GetTimeOnBus());
+    }
+    PassengerPool::Release((*riders)[i]);
+  }
+  int alighted = static_cast<int>(riders->size()) - kept;
+  riders->resize(kept);
+  num_passengers_ -= alighted;
+  num_alighted_ += alighted;
+  return alighted > 0;
+}
+
+// riders still on board never reach their stop, they leave with the bus
+void Bus::Reclaim() {
+  for (int i = 0; i < static_cast<int>(passengers_.size()); i++) {
+    for (std::vector<Passenger *>::iterator it = passengers_[i].begin();
+         it != passengers_[i].end(); it++) {
+      PassengerPool::Release(*it);
+    }
+    passengers_[i].clear();
+  }
+  for (std::vector<Passenger *>::iterator it = stranded_.begin();
+       it != stranded_.end(); it++) {
+    PassengerPool::Release(*it);
+  }
+  stranded_.clear();
+  num_passengers_ = 0;
+  delete outgoing_route_;
+  delete incoming_route_;
+  outgoing_route_ = NULL;
+  incoming_route_ = NULL;
+  segment_ = NULL;
+}
+
 // bool Refuel() {
 //  // This may become more complex in the future
 //  fuel_ = max_fuel_;
@@ -95,26 +211,86 @@ bool Bus::UnloadPassengers(Stop * curr_stop) {
 
 // update all passengers on bus and then call Move() AFTER
 void Bus::Update() {  // using common Update format
-for (std::list<Passenger *>::iterator it = passengers_.begin();
-        it != passengers_.end(); it++) {
-      (*it)->Update();
-    }
-  Move();
+  UpdateTravel();
+  UpdateStop();
   UpdateBusData();
 }
 
+// first half of Move(): only this bus's own state is touched here,
+// so simulators may run it for many buses at once
+void Bus::UpdateTravel(int ticks) {
+  // riders time themselves from the bus's clock
+  clock_ += ticks;
+  pending_stop_ = false;
+  if (IsTripComplete()) {
+    return;
+  }
+  // a bus already at its stop waits for UpdateStop(), otherwise it moves
+  for (int i = 0; i < ticks; i++) {
+    if (distance_remaining_ <= 0) {
+      pending_stop_ = true;
+      break;
+    }
+    distance_remaining_ -= speed_;
+  }
+}
+
+// repeats UpdateTravel()'s subtractions so the count matches it exactly
+int Bus::GetTicksToNextStop() const {
+  double distance = distance_remaining_;
+  if (distance > 0 && speed_ <= 0) {
+    return 0;
+  }
+  int ticks = 1;
+  while (distance > 0) {
+    distance -= speed_;
+    ticks++;
+  }
+  return ticks;
+}
+
+// second half of Move(): stops are shared between buses, so callers
+// must run this one bus at a time in a fixed order
+void Bus::UpdateStop() {
+  if (pending_stop_) {
+    VisitStop();
+    pending_stop_ = false;
+  }
+}
 
 void Bus::Report(std::ostream& os) {
-  os << "Name: " << name_ << std::endl;
-  os << "Speed: " << speed_ << std::endl;
-  os << "Distance to next stop: " << distance_remaining_ << std::endl;
-  os << "\tPassengers (" << passengers_.size() << "): " << std::endl;
-  for (std::list<Passenger *>::iterator it = passengers_.begin();
-       it != passengers_.end(); it++) {
+  os << "Name: " << name_ << "\n";
+  os << "Speed: " << speed_ << "\n";
+  os << "Distance to next stop: " << distance_remaining_ << "\n";
+  os << "\tPassengers (" << num_passengers_ << "): " << "\n";
+  // buckets are already in the order riders get off
+  for (int i = 0; i < static_cast<int>(passengers_.size()); i++) {
+    for (std::vector<Passenger *>::iterator it = passengers_[i].begin();
+         it != passengers_[i].end(); it++) {
+      (*it)->Report();
+    }
+  }
+  for (std::vector<Passenger *>::iterator it = stranded_.begin();
+       it != stranded_.end(); it++) {
     (*it)->Report();
   }
 }
 
+void Bus::Trace(TraceWriter * trace) {
+  trace->WriteBus(name_, speed_, distance_remaining_, num_passengers_);
+  // buckets are already in the order riders get off
+  for (int i = 0; i < static_cast<int>(passengers_.size()); i++) {
+    for (std::vector<Passenger *>::iterator it = passengers_[i].begin();
+         it != passengers_[i].end(); it++) {
+      (*it)->Trace(trace);
+    }
+  }
+  for (std::vector<Passenger *>::iterator it = stranded_.begin();
+       it != stranded_.end(); it++) {
+    (*it)->Trace(trace);
+  }
+}
+
 // checks if both routes have been traversed through completely
 bool Bus::IsTripComplete() {
     if (outgoing_route_->IsAtEnd() && incoming_route_->IsAtEnd()) {
@@ -130,24 +306,18 @@ void Bus::UpdateBusData() {
   bus_data_.num_passengers = GetNumPassengers();
   bus_data_.capacity = GetCapacity();
 
-  double curr_long, curr_lat;
-  double prev_long, prev_lat;
-  // depending on route, store previous stop and current stop coordinates
-  if (!outgoing_route_->IsAtEnd()) {
-    std::tie(prev_long, prev_lat) =
-                      outgoing_route_->GetPreviousStop()->GetCoordinates();
-    std::tie(curr_long, curr_lat) =
-                      outgoing_route_->GetDestinationStop()->GetCoordinates();
-  } else {
-    std::tie(prev_long, prev_lat) =
-                      incoming_route_->GetPreviousStop()->GetCoordinates();
-    std::tie(curr_long, curr_lat) =
-                      incoming_route_->GetDestinationStop()->GetCoordinates();
+  // share of the leg still ahead, from the distance left to cover it
+  double ahead = 0;
+  if (segment_->length > 0 && distance_remaining_ > 0) {
+    ahead = distance_remaining_ / segment_->length;
+    if (ahead > 1) {
+      ahead = 1;
+    }
   }
-  // compute and store the average of the latitudes and longitudes
-  // belonging to the current and previous stops in position
-  bus_data_.position.x = (prev_long + curr_long)/2.0;
-  bus_data_.position.y = (prev_lat + curr_lat)/2.0;
+  const Position& start = segment_->start;
+  const Position& end = segment_->end;
+  bus_data_.position.x = end.x - ahead * (end.x - start.x);
+  bus_data_.position.y = end.y - ahead * (end.y - start.y);
 }
 
 // called by the visualizer to obtain the BusData struct
@@ -171,10 +341,14 @@ Stop * Bus::GetNextStop() {
 
 // called by the visualizer to get the current number of passengers on the bus
 size_t Bus::GetNumPassengers() {
-  return passengers_.size();
+  return num_passengers_;
 }
 
 // called by the visualizer to get max capacity of bus.
 int Bus::GetCapacity() {
   return passenger_max_capacity_;
 }
+
+double Bus::GetLoadFactor() const {
+  return num_departures_ > 0 ? load_sum_ / num_departures_ : 0;
+}
@@ -12,8 +12,8 @@
  ******************************************************************************/
 
 #include <iostream>
-#include <list>
 #include <string>
+#include <vector>
 
 #include "src/passenger.h"
 #include "src/route.h"
@@ -23,7 +23,9 @@
 class PassengerUnloader;
 class PassengerLoader;
 class Route;
+class ServiceKpis;
 class Stop;
+class TraceWriter;
 
 /*******************************************************************************
  * Class Definitions
@@ -32,7 +34,8 @@ class Stop;
  * @brief The main class for the representation of buses.
  *
  * Holds information about movement of bus.
- *  Contains a list of passengers waiting to deboard bus.
+ *  Contains passengers waiting to deboard bus, grouped by the stop visit they
+ *  leave at so everyone leaving at a stop can be unloaded together.
  * 
  */
 class Bus {
@@ -51,7 +54,7 @@ class Bus {
   Bus(std::string name, Route * out, Route * in, int capacity = 60,
                                                  double speed = 1);
   /**
-  * @brief Add Passenger to passengers_ list of bus.
+  * @brief Add Passenger to the passengers_ bucket of the next visit to its destination.
   * @param[out] Passenger gets flagged as on bus with GetOnBus().
   *
   */
@@ -72,17 +75,85 @@ class Bus {
   */
   bool UnloadPassengers(Stop *);
   /**
-  * @brief Calls Update() on each passenger on bus and Move().
+  * @brief Adds a time step to each passenger on bus and calls Move().
   *
   */
   void Update();
   /**
-  * @brief Outputs name_, speed_, distance_remaining_, and calls Report() on all passengers in list.
+  * @brief First half of Update(): updates passengers and moves bus if it is not at a stop.
+  *
+  * Only touches this bus, so it is safe to call for many buses in parallel.
+  *  A bus that is at a stop is left for \ref UpdateStop.
+  *
+  * @param[in] int holding how many time steps to travel, one by default.
+  *  Travel ends early if the bus reaches a stop.
+  */
+  void UpdateTravel(int = 1);
+  /**
+  * @brief Counts the UpdateTravel() steps until the bus is left at its next stop.
+  * @return int of steps, including the one that reaches the stop, or 0 if the bus never gets there.
+  *
+  */
+  int GetTicksToNextStop() const;
+  /**
+  * @brief Unloads then loads passengers at the stop just reached and sets distance to the next stop.
+  *
+  * Called by UpdateStop(), or directly by a BusFleet that moves the bus itself.
+  */
+  void VisitStop();
+  /**
+  * @brief Returns distance the bus travels in one time step.
+  * @return double of speed_.
+  *
+  */
+  double GetSpeed() const { return speed_; }
+  /**
+  * @brief Returns distance left to the next stop.
+  * @return double of distance_remaining_.
+  *
+  */
+  double GetDistanceRemaining() const { return distance_remaining_; }
+  /**
+  * @brief Sets distance left to the next stop, for a BusFleet that moves the bus itself.
+  * @param[in] double holding new distance.
+  *
+  */
+  void SetDistanceRemaining(double distance) { distance_remaining_ = distance; }
+  /**
+  * @brief Has riders time their ride from another clock instead of the bus's own.
+  *
+  * A BusFleet moving every bus each time step shares one clock with all of them.
+  *  Only passengers boarding afterwards use it.
+  *
+  * @param[in] const int * holding the clock, which must outlive the bus.
+  */
+  void ShareClock(const int * clock) { rider_clock_ = clock; }
+  /**
+  * @brief Frees what a finished bus built from route clones still holds.
+  *
+  * Riders go back to the PassengerPool and both routes are deleted. Only for busses
+  *  that own their routes, like those made from Route::Clone() by the simulators.
+  */
+  void Reclaim();
+  /**
+  * @brief Second half of Update(): unloads and loads passengers if UpdateTravel() left the bus at a stop.
+  *
+  * Touches the shared Stop, so buses must call this one at a time and in a fixed order.
+  */
+  void UpdateStop();
+  /**
+  * @brief Outputs name_, speed_, distance_remaining_, and calls Report() on all passengers on bus.
   * @param[in] ostream used to output information.
   * 
   */
   void Report(std::ostream&);
   /**
+  * @brief Records what Report() prints to a binary trace.
+  * @param[in] TraceWriter * receiving the records.
+  *
+  */
+  void Trace(TraceWriter *);
+  /**
   * @brief Checks if bus has finished travelling through all stops of both routes.
   * @return bool indicating if both routes have been traversed through completely.
   * 
@@ -90,6 +161,8 @@ class Bus {
   bool IsTripComplete();
   /**
   * @brief Called by visualizer to instruct bus to populate the BusData struct with latest information.
+  *
+  * The position is placed along the current leg by how much of its distance is left.
   * 
   */
   void UpdateBusData();
@@ -123,16 +196,53 @@ class Bus {
   * 
   */
   int GetCapacity();
+  // passengers that have boarded or alighted since the bus was made
+  int GetNumBoarded() const { return num_boarded_; }
+  int GetNumAlighted() const { return num_alighted_; }
+  /**
+  * @brief Has the bus record waits, rides and its load in a ServiceKpis from now on.
+  * @param[in] ServiceKpis * that outlives the bus, or NULL to stop.
+  *
+  */
+  void SetKpis(ServiceKpis * kpis) { kpis_ = kpis; }
+  /**
+  * @brief Returns riders over capacity, averaged over the stops the bus has left.
+  * @return double between 0 and 1, 0 before the first stop.
+  *
+  */
+  double GetLoadFactor() const;
 
  private:
-  std::list<Passenger *> passengers_;  ///< list of passengers held in bus
+  // first visit ahead to a stop, or -1 if none is ahead
+  int BucketFor(int destination) const;
+  // releases a visit's riders, if it has a bucket yet
+  bool UnloadVisit(int visit, int destination);
+  // releases riders for destination, returns whether any left
+  bool UnloadBucket(std::vector<Passenger *> * riders, int destination);
+
+  // passengers held in bus, one bucket per stop visit: outgoing stops, then
+  // incoming stops, grown only as far as riders are bound
+  std::vector<std::vector<Passenger *>> passengers_;
+  std::vector<Passenger *> stranded_;  ///< riders whose stop is not ahead
+  int next_visit_;  ///< bucket of the stop the bus is heading to
+  int num_passengers_;  ///< total passengers across all buckets
   int passenger_max_capacity_;  ///< maximum amount of passengers held by bus
+  int num_boarded_;  ///< passengers loaded so far
+  int num_alighted_;  ///< passengers unloaded at their stop so far
+  double load_sum_;  ///< riders over capacity, summed at each stop left
+  int num_departures_;  ///< stops left, for GetLoadFactor()
+  ServiceKpis * kpis_;  ///< receives waits and rides when set
   std::string name_;  ///< name of bus
   double speed_;  // could also be called "distance travelled in one time step"
   Route * outgoing_route_;  ///< first route that the bus travels
   Route * incoming_route_;  ///< route traveled on after outgoing route is done
   double distance_remaining_;  // when negative?, unload/load procedure occurs
                               // AND next stop set
+  bool pending_stop_;  ///< set by UpdateTravel() when a stop must be visited
+  int clock_;  ///< time steps travelled, riders time their ride from it
+  const int * rider_clock_;  ///< clock_ unless shared with ShareClock()
+  // leg to the destination stop, only changes when a stop is visited
+  const SegmentGeometry * segment_;
   BusData bus_data_;  ///< struct used for visualizer
   // double revenue_; // revenue collected from passengers, doesn't include
                       // passengers who pay on deboard
@@ -0,0 +1,133 @@
+/**
+ * @file bus_fleet.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+/*******************************************************************************
+* Includes
+******************************************************************************/
+#include "src/bus_fleet.h"
+
+#include "src/bus.h"
+#include "src/service_kpis.h"
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+BusFleet::BusFleet() : num_busses_(0), clock_(0), num_boarded_(0),
+                       num_alighted_(0), kpis_(NULL) {
+}
+
+BusFleet::~BusFleet() {
+  for (int i = 0; i < GetSize(); i++) {
+    if (busses_[i] != NULL) {
+      busses_[i]->Reclaim();
+      delete busses_[i];
+    }
+  }
+}
+
+void BusFleet::Add(Bus * bus) {
+  busses_.push_back(bus);
+  distance_.push_back(bus->GetDistanceRemaining());
+  speed_.push_back(bus->GetSpeed());
+  running_.push_back(!bus->IsTripComplete());
+  at_stop_.push_back(0);
+  num_busses_++;
+  bus->ShareClock(&clock_);
+  bus->SetKpis(kpis_);
+  bus->UpdateBusData();
+}
+
+// the per-step work for every bus, kept to plain arrays and selects
+// so the compiler can vectorize it
+void BusFleet::Advance() {
+  clock_++;
+  int size = GetSize();
+  if (size == 0) {
+    return;
+  }
+  double * distance = &distance_[0];
+  const double * speed = &speed_[0];
+  const char * running = &running_[0];
+  char * at_stop = &at_stop_[0];
+  #pragma omp simd
+  for (int i = 0; i < size; i++) {
+    char arrived = running[i] & (distance[i] <= 0);
+    at_stop[i] = arrived;
+    distance[i] = (running[i] && !arrived) ? distance[i] - speed[i]
+                                           : distance[i];
+  }
+}
+
+// stops are shared, so visits go one bus at a time in the tick
+// engine's order
+void BusFleet::VisitStops() {
+  for (int i = GetSize() - 1; i >= 0; i--) {
+    if (!at_stop_[i]) {
+      continue;
+    }
+    Bus * bus = busses_[i];
+    int boarded = bus->GetNumBoarded();
+    int alighted = bus->GetNumAlighted();
+    bus->SetDistanceRemaining(distance_[i]);
+    bus->VisitStop();
+    num_boarded_ += bus->GetNumBoarded() - boarded;
+    num_alighted_ += bus->GetNumAlighted() - alighted;
+    distance_[i] = bus->GetDistanceRemaining();
+    at_stop_[i] = 0;
+    if (bus->IsTripComplete()) {
+      running_[i] = 0;
+      finished_.push_back(i);
+    }
+  }
+}
+
+void BusFleet::RemoveCompleted() {
+  for (int i = 0; i < static_cast<int>(finished_.size()); i++) {
+    Bus * bus = busses_[finished_[i]];
+    if (kpis_ != NULL) {
+      kpis_->RecordBus(bus->GetLoadFactor());
+    }
+    bus->Reclaim();
+    delete bus;
+    busses_[finished_[i]] = NULL;
+    num_busses_--;
+  }
+  finished_.clear();
+
+  // packing is linear, so it waits until it frees as many slots as it keeps
+  if (GetSize() - num_busses_ > num_busses_) {
+    Compact();
+  }
+}
+
+void BusFleet::Compact() {
+  int kept = 0;
+  for (int i = 0; i < GetSize(); i++) {
+    if (busses_[i] == NULL) {
+      continue;
+    }
+    busses_[kept] = busses_[i];
+    distance_[kept] = distance_[i];
+    speed_[kept] = speed_[i];
+    running_[kept] = running_[i];
+    at_stop_[kept] = at_stop_[i];
+    kept++;
+  }
+  busses_.resize(kept);
+  distance_.resize(kept);
+  speed_.resize(kept);
+  running_.resize(kept);
+  at_stop_.resize(kept);
+}
+
+void BusFleet::Sync() {
+  for (int i = 0; i < GetSize(); i++) {
+    if (busses_[i] != NULL) {
+      busses_[i]->SetDistanceRemaining(distance_[i]);
+      busses_[i]->UpdateBusData();
+    }
+  }
+}
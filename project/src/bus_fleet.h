@@ -0,0 +1,102 @@
+/**
+ * @file bus_fleet.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_BUS_FLEET_H_
+#define SRC_BUS_FLEET_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <vector>
+
+class Bus;
+class ServiceKpis;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Busses that all move every time step, with their movement state in flat arrays.
+ *
+ * Distances and speeds sit in arrays parallel to the busses, so Advance() is one
+ *  branch-free loop over contiguous doubles instead of a call per heap-allocated Bus.
+ *  A Bus is only touched when it reaches a stop. Its own distance and BusData are
+ *  out of date in between, so call Sync() before reading or reporting it.
+ *
+ * The fleet owns its busses. A finished bus leaves an empty slot, so the others
+ *  keep their order, and slots are packed once more than half are empty.
+ */
+class BusFleet {
+ public:
+  BusFleet();
+  /**
+  * @brief Reclaims every bus still in the fleet.
+  *
+  */
+  ~BusFleet();
+
+  /**
+  * @brief Adds a bus at the end of the fleet. The fleet moves and later deletes it.
+  * @param[in] Bus * to add, built from route clones it owns.
+  *
+  */
+  void Add(Bus *);
+  /**
+  * @brief Moves every bus one time step, flagging busses already at a stop.
+  *
+  * Same as calling Bus::UpdateTravel() on each bus.
+  */
+  void Advance();
+  /**
+  * @brief Visits stops for the busses Advance() flagged, newest bus first.
+  *
+  * Same as calling Bus::UpdateStop() on each bus from the back.
+  */
+  void VisitStops();
+  /**
+  * @brief Reclaims busses that finished both routes in the last VisitStops(), emptying their slots.
+  *
+  * Costs one step per finished bus, plus an occasional packing of the slots.
+  */
+  void RemoveCompleted();
+  /**
+  * @brief Copies the arrays back into every Bus so Report(), getters and BusData are current.
+  *
+  */
+  void Sync();
+  /**
+  * @brief Has busses added from now on record into a ServiceKpis, and finished ones record their load.
+  * @param[in] ServiceKpis * that outlives the fleet, or NULL to stop.
+  *
+  */
+  void SetKpis(ServiceKpis * kpis) { kpis_ = kpis; }
+
+  // slots in the order busses were added, empty ones hold NULL
+  int GetSize() const { return static_cast<int>(busses_.size()); }
+  Bus * GetBus(int index) const { return busses_[index]; }
+  int GetNumBusses() const { return num_busses_; }
+  // passengers boarded or alighted by every bus in VisitStops() so far
+  int64_t GetNumBoarded() const { return num_boarded_; }
+  int64_t GetNumAlighted() const { return num_alighted_; }
+
+ private:
+  void Compact();
+
+  std::vector<Bus *> busses_;  ///< busses in the order they were added
+  std::vector<double> distance_;  ///< distance to next stop per bus
+  std::vector<double> speed_;  ///< speed per bus
+  std::vector<char> running_;  ///< cleared once a bus completes its trip
+  std::vector<char> at_stop_;  ///< set by Advance() for busses to visit
+  std::vector<int> finished_;  ///< slots completed since RemoveCompleted()
+  int num_busses_;  ///< slots holding a bus
+  int clock_;  ///< time steps advanced, shared with every bus's riders
+  int64_t num_boarded_;  ///< boardings summed over every visit
+  int64_t num_alighted_;  ///< alightings summed over every visit
+  ServiceKpis * kpis_;  ///< handed to each bus added, NULL for none
+};
+
+#endif  // SRC_BUS_FLEET_H_
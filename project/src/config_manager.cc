@@ -9,131 +9,251 @@
 ******************************************************************************/
 #include "src/config_manager.h"
 
-#include <sstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <iostream>
 #include <list>
-#include <algorithm>
+#include <string>
 
 #include "src/route.h"
 #include "src/stop.h"
 #include "src/random_passenger_generator.h"
 
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+// moves *pos past the next comma (or to lineEnd) and returns the text before
+static std::string NextField(const char ** pos, const char * lineEnd) {
+  const char * start = *pos;
+  const char * comma = static_cast<const char *>(
+                           memchr(start, ',', lineEnd - start));
+  if (comma == NULL) {
+    *pos = lineEnd;
+    return std::string(start, lineEnd);
+  }
+  *pos = comma + 1;
+  return std::string(start, comma);
+}
+
+// names are compared with every space removed, as the old parser did
+static std::string RemoveSpaces(const std::string& text) {
+  std::string result;
+  result.reserve(text.size());
+  for (size_t i = 0; i < text.size(); i++) {
+    if (text[i] != ' ') {
+      result += text[i];
+    }
+  }
+  return result;
+}
+
+// whole field must be a number, apart from surrounding blanks
+static bool ParseDouble(const std::string& field, double * value) {
+  const char * start = field.c_str();
+  char * end;
+  *value = strtod(start, &end);
+  if (end == start) {
+    return false;
+  }
+  while (*end == ' ' || *end == '\t') {
+    end++;
+  }
+  return *end == '\0';
+}
+
+// snapshot values are 32 bit ints and 64 bit doubles in host byte order,
+// strings are a 32 bit length followed by the bytes
+static void AppendInt(std::string * out, int32_t value) {
+  out->append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
 
-// #include <functional>
+static void AppendDouble(std::string * out, double value) {
+  out->append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+static void AppendString(std::string * out, const std::string& value) {
+  AppendInt(out, static_cast<int32_t>(value.size()));
+  out->append(value);
+}
 
+// reads from the mapped file, false once the end would be passed
+struct SnapshotCursor {
+  const char * pos;
+  const char * end;
+
+  bool Take(void * value, size_t size) {
+    if (static_cast<size_t>(end - pos) < size) {
+      return false;
+    }
+    memcpy(value, pos, size);
+    pos += size;
+    return true;
+  }
+  bool TakeInt(int * value) {
+    int32_t raw;
+    if (!Take(&raw, sizeof(raw))) {
+      return false;
+    }
+    *value = raw;
+    return true;
+  }
+  bool TakeDouble(double * value) {
+    return Take(value, sizeof(*value));
+  }
+  bool TakeString(std::string * value) {
+    int size;
+    if (!TakeInt(&size) || size < 0 || end - pos < size) {
+      return false;
+    }
+    value->assign(pos, size);
+    pos += size;
+    return true;
+  }
+};
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+const char ConfigManager::kSnapshotMagic[4] = {'B', 'N', 'E', 'T'};
+const int ConfigManager::kSnapshotVersion;
 
 ConfigManager::ConfigManager() : routes(std::vector<Route *>()) {
 }
 
 ConfigManager::~ConfigManager() {
     for (int i = 0; i < static_cast<int>(routes.size()); i++) {
-      routes[i] = nullptr;
+      delete routes[i];
+      delete generators[i];
     }
     routes.clear();
+    for (int i = 0; i < static_cast<int>(stops.size()); i++) {
+      stops[i]->ReleasePassengers();
+      delete stops[i];
+    }
 }
 
-void ConfigManager::ReadConfig(const std::string filename) {
-    std::ifstream configFile("config/" + filename);
+// the whole file is read with one call, then parsed from memory
+bool ConfigManager::ReadConfig(const std::string filename) {
+    std::string path = "config/" + filename;
+    std::ifstream configFile(path, std::ios::binary);
+    if (!configFile) {
+      AddError(path, 0, "could not open file");
+      return false;
+    }
 
-    // std::hash<std::string> stringHash;
+    // compiled networks skip the parser entirely
+    char magic[sizeof(kSnapshotMagic)];
+    if (configFile.read(magic, sizeof(magic)) &&
+        memcmp(magic, kSnapshotMagic, sizeof(magic)) == 0) {
+      return ReadSnapshot(filename);
+    }
+    configFile.clear();
 
-    std::list<Stop *> stops = std::list<Stop *>();
-    std::list<double> distances = std::list<double>();
+    configFile.seekg(0, std::ios::end);
+    std::string text(static_cast<size_t>(configFile.tellg()), '\0');
+    configFile.seekg(0, std::ios::beg);
+    configFile.read(&text[0], text.size());
+
+    return ParseConfig(text, path);
+}
+
+bool ConfigManager::ParseConfig(const std::string& text,
+                                const std::string& source) {
+    size_t numErrors = errors.size();
+
+    std::vector<int> routeStops;
+    std::vector<double> distances;
+    std::vector<double> currProbabilities;
     double oldLat = 0;
     double oldLon = 0;
-    std::list<double> currProbabilities = std::list<double>();
     std::string currGeneralName = "";
     std::string currRouteName = "";
 
-    std::vector<std::string> stopNames = std::vector<std::string>();
-    int stopId = 10;
-
-    std::string line;
-    while (std::getline(configFile, line)) {
-      std::istringstream stringStream(line);
-      std::string chunk;
+    const char * pos = text.data();
+    const char * end = pos + text.size();
+    int lineNumber = 0;
+    while (pos < end) {
+      const char * newline = static_cast<const char *>(
+                                 memchr(pos, '\n', end - pos));
+      const char * lineEnd = newline ? newline : end;
+      const char * next = newline ? newline + 1 : end;
+      lineNumber++;
+      if (lineEnd > pos && lineEnd[-1] == '\r') {
+        lineEnd--;
+      }
 
-      if (!std::getline(stringStream, chunk, ',')) { continue; }
+      std::string chunk = NextField(&pos, lineEnd);
 
       if (chunk == "ROUTE_GENERAL") {
-        currGeneralName = "";
-        std::getline(stringStream, currGeneralName);
+        currGeneralName = std::string(pos, lineEnd);
 
       } else if (chunk == "ROUTE") {
+        std::string routeName = RemoveSpaces(std::string(pos, lineEnd));
+        if (routeName.empty()) {
+          AddError(source, lineNumber, "ROUTE row has no name");
+        }
+
         // If we are coming to a route besides our first one, save all our
         // data and init variables for next route
-        if (stops.size() > 0) {
-          // Convert our variables into the necessary raw memory
-          int numStops = static_cast<int>(stops.size());
-          Stop ** rawStops = new Stop *[numStops];
-          int it = 0;
-          for (auto* s : stops) {
-            rawStops[it] = s;
-            it++;
-          }
-
-          int numDists = static_cast<int>(distances.size());
-          double * rawDists = new double[numDists];
-          it = 0;
-          for (const auto& d : distances) {
-            rawDists[it] = d;
-            it++;
-          }
-
-          routes.push_back(
-                  new Route(
-                      currGeneralName + " " + currRouteName,
-                      rawStops,
-                      rawDists,
-                      static_cast<int>(stops.size()),
-                      new RandomPassengerGenerator(currProbabilities,
-                                                    stops)));
-
-          stops.clear();
+        if (routeStops.size() > 0) {
+          AddRoute(currGeneralName + " " + currRouteName, routeStops,
+                   distances, currProbabilities);
+          routeStops.clear();
           distances.clear();
           currProbabilities.clear();
         }
         oldLat = 0;  // Refresh our old values on a new route
         oldLon = 0;
 
-        std::getline(stringStream, currRouteName);
-        currRouteName.erase(std::remove(currRouteName.begin(),
-                            currRouteName.end(), ' '), currRouteName.end());
+        currRouteName = routeName;
 
       } else if (chunk == "STOP") {
         // Grab our comma seperated values
-        std::string stopName;
-        std::getline(stringStream, stopName, ',');
-        stopName.erase(std::remove(stopName.begin(), stopName.end(), ' '),
-                                    stopName.end());
-
-        // Check if the stop already exists
-        std::vector<std::string>::iterator it = std::find(stopNames.begin(),
-                                                  stopNames.end(), stopName);
-        if (it != stopNames.end()) {
-          // We have already seen this stop
-          int index = std::distance(stopNames.begin(), it);
-
-          std::list<Stop *>::iterator iter = stops.begin();
-          std::advance(iter, index);
-
-          stops.push_back(*iter);
+        std::string stopName = RemoveSpaces(NextField(&pos, lineEnd));
+        std::string latString = NextField(&pos, lineEnd);
+        std::string lonString = NextField(&pos, lineEnd);
+        std::string probString = std::string(pos, lineEnd);
+
+        double latitude, longitude, probability;
+        if (stopName.empty()) {
+          AddError(source, lineNumber, "STOP row has no name");
+          pos = next;
+          continue;
+        }
+        if (!ParseDouble(latString, &latitude) ||
+            !ParseDouble(lonString, &longitude)) {
+          AddError(source, lineNumber, "STOP " + stopName +
+                   " has a bad coordinate");
+          pos = next;
+          continue;
+        }
+        if (!ParseDouble(probString, &probability)) {
+          AddError(source, lineNumber, "STOP " + stopName +
+                   " has a bad probability");
+          pos = next;
           continue;
         }
 
-        // If we have not seen this stop, set it up
-        int id = stopId;
-        stopId++;
-
-        std::string latString;
-        std::getline(stringStream, latString, ',');
-        double latitude = std::stod(latString);
-
-        std::string lonString;
-        std::getline(stringStream, lonString, ',');
-        double longitude = std::stod(lonString);
-
-        stops.push_back(new Stop(id, latitude, longitude));
+        // Check if the stop already exists, on this route or any other.
+        // A shared stop keeps the coordinates it was first listed with,
+        // each route still measures its segments from its own rows
+        std::unordered_map<std::string, int>::iterator seen =
+            stopsByName.find(stopName);
+        if (seen != stopsByName.end()) {
+          routeStops.push_back(seen->second);
+        } else {
+          routeStops.push_back(AddStop(stopName, nextStopId, latitude,
+                                       longitude));
+          nextStopId++;
+        }
 
         // Need to turn these lat and long into real-world distances
         // This means moving 1 speed in a time click moves 1 mile.
@@ -143,7 +263,7 @@ void ConfigManager::ReadConfig(const std::string filename) {
 
         // Grabbing last element from list is hard, so cache position
         // instead
-        if (stops.size() > 1) {
+        if (routeStops.size() > 1) {
           double dist = sqrt((latitude-oldLat)*(latitude-oldLat)
                               + (longitude-oldLon)*(longitude-oldLon));
           distances.push_back(dist);
@@ -151,43 +271,180 @@ void ConfigManager::ReadConfig(const std::string filename) {
         oldLat = latitude;
         oldLon = longitude;
 
-        std::string probString;
-        std::getline(stringStream, probString);
-        double probability = std::stod(probString);
-
         currProbabilities.push_back(probability);
       }
+
+      pos = next;
     }
 
     // Generatre our last route
-    if (stops.size() > 0) {
-      // Convert our variables into the necessary raw memory
-      int numStops = static_cast<int>(stops.size());
-      Stop ** rawStops = new Stop *[numStops];
-      int it = 0;
-      for (auto* s : stops) {
-        rawStops[it] = s;
-        it++;
+    if (routeStops.size() > 0) {
+      AddRoute(currGeneralName + " " + currRouteName, routeStops, distances,
+               currProbabilities);
+    }
+
+    return errors.size() == numErrors;
+}
+
+bool ConfigManager::WriteSnapshot(const std::string filename) const {
+    std::string out;
+    out.append(kSnapshotMagic, sizeof(kSnapshotMagic));
+    AppendInt(&out, kSnapshotVersion);
+    AppendInt(&out, nextStopId);
+    AppendInt(&out, static_cast<int>(stopRecords.size()));
+    AppendInt(&out, static_cast<int>(routeRecords.size()));
+
+    for (size_t i = 0; i < stopRecords.size(); i++) {
+      AppendString(&out, stopRecords[i].name);
+      AppendInt(&out, stopRecords[i].id);
+      AppendDouble(&out, stopRecords[i].latitude);
+      AppendDouble(&out, stopRecords[i].longitude);
+    }
+
+    for (size_t i = 0; i < routeRecords.size(); i++) {
+      const RouteRecord& route = routeRecords[i];
+      AppendString(&out, route.name);
+      AppendInt(&out, static_cast<int>(route.stops.size()));
+      for (size_t j = 0; j < route.stops.size(); j++) {
+        AppendInt(&out, route.stops[j]);
+      }
+      for (size_t j = 0; j < route.distances.size(); j++) {
+        AppendDouble(&out, route.distances[j]);
+      }
+      for (size_t j = 0; j < route.probabilities.size(); j++) {
+        AppendDouble(&out, route.probabilities[j]);
       }
+    }
 
-      int numDists = static_cast<int>(distances.size());
-      double * rawDists = new double[numDists];
-      it = 0;
-      for (const auto& d : distances) {
-        rawDists[it] = d;
-        it++;
+    std::ofstream snapshotFile("config/" + filename, std::ios::binary);
+    snapshotFile.write(out.data(), out.size());
+    return static_cast<bool>(snapshotFile);
+}
+
+bool ConfigManager::ReadSnapshot(const std::string filename) {
+    std::string path = "config/" + filename;
+    int fd = open(path.c_str(), O_RDONLY);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0 || info.st_size == 0) {
+      if (fd >= 0) {
+        close(fd);
       }
+      AddError(path, 0, "could not open snapshot");
+      return false;
+    }
+    void * mapped = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+      AddError(path, 0, "could not map snapshot");
+      return false;
+    }
 
-      routes.push_back(
-              new Route(
-                  currGeneralName + " " + currRouteName,
-                  rawStops,
-                  rawDists,
-                  static_cast<int>(stops.size()),
-                  new RandomPassengerGenerator(currProbabilities, stops)));
+    SnapshotCursor in;
+    in.pos = static_cast<const char *>(mapped);
+    in.end = in.pos + info.st_size;
+
+    char magic[sizeof(kSnapshotMagic)];
+    int version, savedNextStopId, numStops, numRoutes;
+    bool ok = in.Take(magic, sizeof(magic)) &&
+              memcmp(magic, kSnapshotMagic, sizeof(magic)) == 0 &&
+              in.TakeInt(&version) && version == kSnapshotVersion &&
+              in.TakeInt(&savedNextStopId) && in.TakeInt(&numStops) &&
+              in.TakeInt(&numRoutes) && numStops >= 0 && numRoutes >= 0;
+
+    // snapshot stop i may already be registered, so indices are remapped
+    std::vector<int> stopIndex;
+    for (int i = 0; ok && i < numStops; i++) {
+      std::string name;
+      int id;
+      double latitude, longitude;
+      ok = in.TakeString(&name) && in.TakeInt(&id) &&
+           in.TakeDouble(&latitude) && in.TakeDouble(&longitude);
+      if (ok) {
+        std::unordered_map<std::string, int>::iterator seen =
+            stopsByName.find(name);
+        stopIndex.push_back(seen != stopsByName.end() ? seen->second :
+                            AddStop(name, id, latitude, longitude));
+      }
+    }
+    if (ok && savedNextStopId > nextStopId) {
+      nextStopId = savedNextStopId;
     }
 
-    currProbabilities.clear();
-    stops.clear();
-    distances.clear();
+    for (int i = 0; ok && i < numRoutes; i++) {
+      std::string name;
+      int numRouteStops;
+      ok = in.TakeString(&name) && in.TakeInt(&numRouteStops) &&
+           numRouteStops > 0;
+      std::vector<int> routeStops(ok ? numRouteStops : 0);
+      std::vector<double> distances(ok ? numRouteStops - 1 : 0);
+      std::vector<double> probabilities(ok ? numRouteStops : 0);
+      for (int j = 0; ok && j < numRouteStops; j++) {
+        ok = in.TakeInt(&routeStops[j]) && routeStops[j] >= 0 &&
+             routeStops[j] < numStops;
+        if (ok) {
+          routeStops[j] = stopIndex[routeStops[j]];
+        }
+      }
+      for (int j = 0; ok && j < numRouteStops - 1; j++) {
+        ok = in.TakeDouble(&distances[j]);
+      }
+      for (int j = 0; ok && j < numRouteStops; j++) {
+        ok = in.TakeDouble(&probabilities[j]);
+      }
+      if (ok) {
+        AddRoute(name, routeStops, distances, probabilities);
+      }
+    }
+
+    munmap(mapped, info.st_size);
+    if (!ok) {
+      AddError(path, 0, "snapshot is not version " +
+               std::to_string(kSnapshotVersion) + " or is cut short");
+    }
+    return ok;
+}
+
+int ConfigManager::AddStop(const std::string& name, int id, double latitude,
+                           double longitude) {
+    StopRecord record = {name, id, latitude, longitude};
+    stopRecords.push_back(record);
+    stops.push_back(new Stop(id, latitude, longitude));
+    stopsByName[name] = static_cast<int>(stops.size()) - 1;
+    return static_cast<int>(stops.size()) - 1;
+}
+
+void ConfigManager::AddRoute(const std::string& name,
+                             const std::vector<int>& routeStops,
+                             const std::vector<double>& distances,
+                             const std::vector<double>& probabilities) {
+    RouteRecord record = {name, routeStops, distances, probabilities};
+    routeRecords.push_back(record);
+
+    // Route copies the arrays, the generator still takes lists
+    std::vector<Stop *> rawStops;
+    for (size_t i = 0; i < routeStops.size(); i++) {
+      rawStops.push_back(stops[routeStops[i]]);
+    }
+    std::vector<double> rawDists(distances);
+    generators.push_back(
+            new RandomPassengerGenerator(
+                std::list<double>(probabilities.begin(), probabilities.end()),
+                std::list<Stop *>(rawStops.begin(), rawStops.end())));
+    routes.push_back(
+            new Route(
+                name,
+                rawStops.data(),
+                rawDists.data(),
+                static_cast<int>(rawStops.size()),
+                generators.back()));
+}
+
+void ConfigManager::AddError(const std::string& source, int lineNumber,
+                             const std::string& message) {
+    std::string error = source + ": " + message;
+    if (lineNumber > 0) {
+      error = source + ":" + std::to_string(lineNumber) + ": " + message;
+    }
+    std::cerr << error << std::endl;
+    errors.push_back(error);
 }
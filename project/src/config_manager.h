@@ -9,20 +9,103 @@
 
 #include <vector>
 #include <string>
+#include <unordered_map>
 
+class RandomPassengerGenerator;
 class Route;
+class Stop;
 
 class ConfigManager {
  public:
   ConfigManager();
+  // deletes the routes, their generators and the stops, with anyone still
+  // waiting, so simulators using them must be gone first
   ~ConfigManager();
+  ConfigManager(const ConfigManager&) = delete;
+  ConfigManager& operator=(const ConfigManager&) = delete;
 
-  void ReadConfig(const std::string filename);
+  static const char kSnapshotMagic[4];  // first bytes of a snapshot file
+  static const int kSnapshotVersion = 1;  // bumped when the layout changes
+
+  /**
+  * @brief Reads config/<filename> in one go and parses it with ParseConfig().
+  *
+  * A file starting with kSnapshotMagic is loaded with ReadSnapshot() instead.
+  *
+  * @param[in] string holding file name inside the config directory.
+  * @return bool false if the file is missing or has malformed rows.
+  */
+  bool ReadConfig(const std::string filename);
+  /**
+  * @brief Writes every stop and route read so far to config/<filename> as a binary snapshot.
+  *
+  * Stop ids, coordinates, distances and probabilities are stored exactly as
+  *  computed, so a run from the snapshot matches a run from the text config.
+  *
+  * @param[in] string holding file name inside the config directory.
+  * @return bool false if the file could not be written.
+  */
+  bool WriteSnapshot(const std::string filename) const;
+  /**
+  * @brief Builds stops and routes from a snapshot by mapping the file, with no text parsing or distance math.
+  * @param[in] string holding file name inside the config directory.
+  * @return bool false if the file is missing, of another version, or cut short.
+  */
+  bool ReadSnapshot(const std::string filename);
+  /**
+  * @brief Builds routes from config text already in memory, in a single pass.
+  *
+  * Malformed STOP and ROUTE rows are skipped and reported with their line
+  *  number on std::cerr and in GetErrors().
+  *
+  * @param[in] string holding the whole config.
+  * @param[in] string naming where the text came from, used in error messages.
+  * @return bool false if any row was malformed.
+  */
+  bool ParseConfig(const std::string& text,
+                   const std::string& source = "config");
 
   std::vector<Route *> GetRoutes() const { return routes; }
+  // generator of each route, in the same order
+  const std::vector<RandomPassengerGenerator *>& GetGenerators() const {
+    return generators;
+  }
+  // every distinct stop, a stop named on several routes appears once
+  const std::vector<Stop *>& GetStops() const { return stops; }
+  const std::vector<std::string>& GetErrors() const { return errors; }
 
  private:
+  // what was read, kept so the network can be written as a snapshot
+  struct StopRecord {
+    std::string name;
+    int id;
+    double latitude;
+    double longitude;
+  };
+  struct RouteRecord {
+    std::string name;
+    std::vector<int> stops;  // indices into stopRecords
+    std::vector<double> distances;
+    std::vector<double> probabilities;
+  };
+
+  int AddStop(const std::string& name, int id, double latitude,
+              double longitude);
+  void AddRoute(const std::string& name, const std::vector<int>& routeStops,
+                const std::vector<double>& distances,
+                const std::vector<double>& probabilities);
+  void AddError(const std::string& source, int lineNumber,
+                const std::string& message);
+
   std::vector<Route *> routes;
+  std::vector<RandomPassengerGenerator *> generators;  // parallel to routes
+  // stop registry shared by all routes, keyed by name without spaces
+  std::vector<Stop *> stops;
+  std::unordered_map<std::string, int> stopsByName;  // index into stops
+  int nextStopId = 10;
+  std::vector<StopRecord> stopRecords;  // parallel to stops
+  std::vector<RouteRecord> routeRecords;  // parallel to routes
+  std::vector<std::string> errors;  // "file:line: message" per bad row
 };
 
 #endif  // SRC_CONFIG_MANAGER_H_
@@ -10,7 +10,9 @@
 #include "src/configuration_simulator.h"
 
 #include "src/bus.h"
+#include "src/passenger_generator.h"
 #include "src/route.h"
+#include "src/stop.h"
 
 // used in configuration_sim.cc
 ConfigurationSimulator::ConfigurationSimulator(ConfigManager* configM) {
@@ -33,11 +35,14 @@ void ConfigurationSimulator::Start(const std::vector<int>& busStartTimings,
   }
 
   simulationTimeElapsed_ = 0;
+  numGenerated_ = 0;
 
   // call report on all routes in config file and update route structs
   prototypeRoutes_ = configManager_->GetRoutes();
   for (int i = 0; i < static_cast<int>(prototypeRoutes_.size()); i++) {
-    prototypeRoutes_[i]->Report(std::cout);
+    if (reportLevel_ == kReportFull) {
+      prototypeRoutes_[i]->Report(std::cout);
+    }
 
     prototypeRoutes_[i]->UpdateRouteData();
   }
@@ -45,53 +50,164 @@ void ConfigurationSimulator::Start(const std::vector<int>& busStartTimings,
 
 void ConfigurationSimulator::Update() {
   simulationTimeElapsed_++;
+  bool full = (reportLevel_ == kReportFull);
+  if (profiler_ != NULL) {
+    profiler_->BeginTick(simulationTimeElapsed_);
+  }
 
-  std::cout << "~~~~~~~~~~ The time is now " << simulationTimeElapsed_;
-  std::cout << "~~~~~~~~~~" << std::endl;
+  if (full) {
+    PhaseProfiler::PhaseTimer timer(profiler_, PhaseProfiler::kReport);
+    std::cout << "~~~~~~~~~~ The time is now " << simulationTimeElapsed_;
+    std::cout << "~~~~~~~~~~" << std::endl;
 
-  std::cout << "~~~~~~~~~~ Generating new busses if needed ";
-  std::cout << "~~~~~~~~~~" << std::endl;
+    std::cout << "~~~~~~~~~~ Generating new busses if needed ";
+    std::cout << "~~~~~~~~~~" << std::endl;
+  }
 
   // Check if we need to generate new busses
-  for (int i = 0; i < static_cast<int>(timeSinceLastBus_.size()); i++) {
-    // Check if we need to make a new bus
-    if (0 >= timeSinceLastBus_[i]) {
-      Route * outbound = prototypeRoutes_[2 * i];
-      Route * inbound = prototypeRoutes_[2 * i + 1];
-
-      busses_.push_back(new Bus(std::to_string(busId), outbound->Clone(),
-                                                inbound->Clone(), 60, 1));
-      busId++;
-
-      // restart time since last bus if new bus created
-      timeSinceLastBus_[i] = busStartTimings_[i];
-    } else {
-      timeSinceLastBus_[i]--;
+  int spawned = 0;
+  {
+    PhaseProfiler::PhaseTimer timer(profiler_, PhaseProfiler::kSpawn);
+    for (int i = 0; i < static_cast<int>(timeSinceLastBus_.size()); i++) {
+      // Check if we need to make a new bus
+      if (0 >= timeSinceLastBus_[i]) {
+        Route * outbound = prototypeRoutes_[2 * i];
+        Route * inbound = prototypeRoutes_[2 * i + 1];
+
+        busses_.Add(new Bus(std::to_string(busId), outbound->Clone(),
+                            inbound->Clone(), busCapacity_, busSpeed_));
+        busId++;
+        spawned++;
+
+        // restart time since last bus if new bus created
+        timeSinceLastBus_[i] = busStartTimings_[i];
+      } else {
+        timeSinceLastBus_[i]--;
+      }
     }
   }
 
-  std::cout << "~~~~~~~~~ Updating routes ";
-  std::cout << "~~~~~~~~~" << std::endl;
+  if (full) {
+    PhaseProfiler::PhaseTimer timer(profiler_, PhaseProfiler::kReport);
+    std::cout << "~~~~~~~~~ Updating routes ";
+    std::cout << "~~~~~~~~~" << std::endl;
+  }
   // Update routes
-  for (int i = 0; i < static_cast<int>(prototypeRoutes_.size()); i++) {
-    prototypeRoutes_[i]->Update();
+  // each route's generator has its own random stream and its own queue
+  // at every stop, even shared ones, so passengers are generated for all
+  // routes in parallel first
+  int num_routes = static_cast<int>(prototypeRoutes_.size());
+  int64_t generated = 0;
+  {
+    PhaseProfiler::PhaseTimer timer(profiler_, PhaseProfiler::kGenerate);
+    #pragma omp parallel for reduction(+:generated) \
+                             if (num_routes >= kMinParallelRoutes)
+    for (int i = 0; i < num_routes; i++) {
+      generated += prototypeRoutes_[i]->GenerateNewPassengers();
+    }
+  }
+  numGenerated_ += generated;
+  if (!full) {
+    // one timer for the whole phase, so its cost stays the same however
+    // many routes there are
+    PhaseProfiler::PhaseTimer timer(profiler_, PhaseProfiler::kStops);
+    for (int i = 0; i < num_routes; i++) {
+      prototypeRoutes_[i]->UpdateStops();
+    }
+  } else {
+    // each route reports right after its own stops update, as it always has
+    for (int i = 0; i < num_routes; i++) {
+      {
+        PhaseProfiler::PhaseTimer timer(profiler_, PhaseProfiler::kStops);
+        prototypeRoutes_[i]->UpdateStops();
+      }
+      PhaseProfiler::PhaseTimer timer(profiler_, PhaseProfiler::kReport);
+      prototypeRoutes_[i]->Report(std::cout);
+    }
+  }
+
+  if (full) {
+    PhaseProfiler::PhaseTimer timer(profiler_, PhaseProfiler::kReport);
+    std::cout << "~~~~~~~~~ Updating busses ";
+    std::cout << "~~~~~~~~~" << std::endl;
+  }
+
+  // Update busses
+  // the fleet moves every bus in one pass over its arrays, then resolves
+  // arrivals one bus at a time in the order a serial Update() would use,
+  // since stops are shared, keeping output identical
+  int64_t boarded = busses_.GetNumBoarded();
+  int64_t alighted = busses_.GetNumAlighted();
+  int running = busses_.GetNumBusses();
+  {
+    PhaseProfiler::PhaseTimer timer(profiler_, PhaseProfiler::kBusses);
+    busses_.Advance();
+    busses_.VisitStops();
+    busses_.RemoveCompleted();
+  }
 
-    prototypeRoutes_[i]->Report(std::cout);
+  if (full) {
+    PhaseProfiler::PhaseTimer timer(profiler_, PhaseProfiler::kReport);
+    busses_.Sync();
+    for (int i = busses_.GetSize() - 1; i >= 0; i--) {
+      if (busses_.GetBus(i) != NULL) {
+        busses_.GetBus(i)->Report(std::cout);
+      }
+    }
   }
 
+  if (reportLevel_ == kReportSummary) {
+    PhaseProfiler::PhaseTimer timer(profiler_, PhaseProfiler::kReport);
+    ReportSummary(std::cout);
+  }
 
-  std::cout << "~~~~~~~~~ Updating busses ";
-  std::cout << "~~~~~~~~~" << std::endl;
+  if (profiler_ != NULL) {
+    profiler_->Count(PhaseProfiler::kGenerated, generated);
+    profiler_->Count(PhaseProfiler::kBoarded,
+                     busses_.GetNumBoarded() - boarded);
+    profiler_->Count(PhaseProfiler::kAlighted,
+                     busses_.GetNumAlighted() - alighted);
+    profiler_->Count(PhaseProfiler::kSpawned, spawned);
+    profiler_->Count(PhaseProfiler::kRetired,
+                     running - busses_.GetNumBusses());
+    profiler_->EndTick();
+  }
+}
 
-  // Update busses
-  for (int i = static_cast<int>(busses_.size()) - 1; i >= 0; i--) {
-    busses_[i]->Update();
+void ConfigurationSimulator::SetReportLevel(ReportLevel level) {
+  reportLevel_ = level;
+  PassengerGenerator::SetReportLevel(level);
+}
 
-    if (busses_[i]->IsTripComplete()) {
-      busses_.erase(busses_.begin() + i);
-      continue;
+// same order Update() reports in, without the banners
+void ConfigurationSimulator::Report(std::ostream& out) {
+  for (int i = 0; i < static_cast<int>(prototypeRoutes_.size()); i++) {
+    prototypeRoutes_[i]->Report(out);
+  }
+  busses_.Sync();
+  for (int i = busses_.GetSize() - 1; i >= 0; i--) {
+    if (busses_.GetBus(i) != NULL) {
+      busses_.GetBus(i)->Report(out);
     }
+  }
+}
 
-    busses_[i]->Report(std::cout);
+void ConfigurationSimulator::ReportSummary(std::ostream& out) {
+  // stops are shared between routes, so each is counted once from the registry
+  int num_waiting = 0;
+  const std::vector<Stop *>& stops = configManager_->GetStops();
+  for (int i = 0; i < static_cast<int>(stops.size()); i++) {
+    num_waiting += stops[i]->GetNumPassengers();
   }
+
+  int num_riding = 0;
+  for (int i = 0; i < busses_.GetSize(); i++) {
+    if (busses_.GetBus(i) != NULL) {
+      num_riding += static_cast<int>(busses_.GetBus(i)->GetNumPassengers());
+    }
+  }
+
+  out << "Time " << simulationTimeElapsed_ << ": " << busses_.GetNumBusses()
+      << " busses, " << num_waiting << " waiting, " << num_riding
+      << " riding\n";
 }
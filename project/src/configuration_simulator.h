@@ -10,10 +10,16 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <cstdint>
+#include <iostream>
 #include <vector>
 #include <list>
 
+#include "src/bus_fleet.h"
 #include "src/config_manager.h"
+#include "src/phase_profiler.h"
+#include "src/service_kpis.h"
+#include "src/report_level.h"
 
 class Route;
 class Bus;
@@ -54,19 +60,83 @@ class ConfigurationSimulator {
   *
   */
   void Update();
+  /**
+  * @brief Sets how much Start() and Update() write, including passenger generators.
+  * @param[in] ReportLevel to use from now on, kReportFull by default.
+  *
+  */
+  void SetReportLevel(ReportLevel);
+  /**
+  * @brief Sets how much Start() and Update() write, leaving the passenger generators' level alone.
+  *
+  * That level is shared by every generator, so simulators running side by side set it once
+  *  beforehand and use this instead.
+  *
+  * @param[in] ReportLevel to use from now on.
+  *
+  */
+  void SetOwnReportLevel(ReportLevel level) { reportLevel_ = level; }
+  /**
+  * @brief Writes every route, then every bus newest first, as Update() does at full level.
+  * @param[in] ostream to write to.
+  *
+  */
+  void Report(std::ostream&);
+  /**
+  * @brief Has Update() time its phases and count what happens in them.
+  * @param[in] PhaseProfiler * that outlives the simulator, or NULL to stop.
+  *
+  */
+  void SetProfiler(PhaseProfiler * profiler) { profiler_ = profiler; }
+  /**
+  * @brief Has busses started from now on record waits, rides and loads.
+  * @param[in] ServiceKpis * that outlives the simulator, or NULL to stop.
+  *
+  */
+  void SetKpis(ServiceKpis * kpis) { busses_.SetKpis(kpis); }
+  /**
+  * @brief Sets the capacity and speed of busses started from now on.
+  * @param[in] int holding passengers a bus holds, 60 by default.
+  * @param[in] double holding distance a bus travels per time step, 1 by default.
+  *
+  */
+  void SetBusParameters(int capacity, double speed) {
+    busCapacity_ = capacity;
+    busSpeed_ = speed;
+  }
+  int GetTime() const { return simulationTimeElapsed_; }
+  // every passenger the routes generated since Start()
+  int64_t GetNumGenerated() const { return numGenerated_; }
+  // busses running now, finished ones are already gone
+  int GetNumBusses() const { return busses_.GetNumBusses(); }
 
  private:
+  /**
+  * @brief Writes one line with time, bus count, waiting and riding passengers.
+  * @param[in] ostream to write to.
+  *
+  */
+  void ReportSummary(std::ostream&);
+
   ConfigManager* configManager_;  ///< used to read config file
 
   std::vector<int> busStartTimings_;  ///< interval between busses created
   std::vector<int> timeSinceLastBus_;  ///< countdown until next bus created
   int numTimeSteps_;  ///< total time steps of simulation
   int simulationTimeElapsed_;  ///< time past so far in simulation
+  int64_t numGenerated_ = 0;  ///< passengers generated since Start()
 
   std::vector<Route *> prototypeRoutes_;  ///< holds routes in config file
-  std::vector<Bus *> busses_;  ///< holds busses that hold routes
+  BusFleet busses_;  ///< holds busses that hold routes, and moves them
 
   int busId = 1000;  ///< starting index of bus
+  int busCapacity_ = 60;  ///< capacity of each new bus
+  double busSpeed_ = 1;  ///< speed of each new bus
+  ReportLevel reportLevel_ = kReportFull;  ///< how much Update() writes
+  PhaseProfiler * profiler_ = NULL;  ///< times Update()'s phases when set
+
+  /// smaller networks generate serially, threads would cost more than they save
+  static const int kMinParallelRoutes = 8;
 };
 
 #endif  // SRC_CONFIGURATION_SIMULATOR_H_
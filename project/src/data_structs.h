@@ -31,6 +31,14 @@ struct StopData {
     int num_people;
 };
 
+// one leg of a route, precomputed for drawing busses along it
+struct SegmentGeometry {
+    SegmentGeometry() : start(Position()), end(Position()), length(0) {}
+    Position start;  // previous stop, where the leg begins
+    Position end;  // stop the leg leads to
+    double length;  // distance a bus is given to cover the leg
+};
+
 struct RouteData {
     RouteData() : id(""), stops(std::vector<StopData>(0)) {}
     std::string id;  // some unique identifier for the route
@@ -6,6 +6,8 @@
 #include <random>
 #include <string>
 #include "src/deterministic_passenger_factory.h"
+#include "src/passenger_name_table.h"
+#include "src/passenger_pool.h"
 
 /*
  * if CONSPASS is defined, every passenger will have the same name and desination
@@ -14,37 +16,6 @@
  */
 #define CONSTPASS 1
 
-// Here I will create an array of prefixes to help generate names.
-// I am banking on multiplication to ensure a large number of names
-// by using 7 prefixes and 20 stems, and 16 suffixes I should be able to
-// create about 7 * 20 * 16 = 2240 names out of 312 bytes of data (In my earlier
-// example from the forum I used this code to generate male and female names,
-// but here I combined them).
-
-static const char* NamePrefixArray[7] = {
-"",  // who said we need to add a prefix?
-"bel",  // lets say that means "the good"
-"nar",  // "The not so good as Bel"
-"xan",  //" The evil"
-"bell",  // "the good"
-"natr",  // "the neutral/natral"
-"ev",  // Man am I original
-};
-
-static const char* NameSuffixArray[16] = {
-"", "us", "ix", "ox", "ith",
-"ath", "um", "ator", "or", "axia",
-"imus", "ais", "itur", "orex", "o",
-"y"
-};
-
-static const char* NameStemsArray[20] = {
-"adur", "aes", "anim", "apoll", "imac",
-"educ", "equis", "extr", "guius", "hann",
-"equi", "amora", "hum", "iace", "ille",
-"inept", "iuv", "obe", "ocul", "orbis"
-};
-
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
@@ -52,7 +23,7 @@ static const char* NameStemsArray[20] = {
 // https://www.dreamincode.net/forums/topic/27024-data-modeling-for-games-in-c-part-ii/
 Passenger * DeterministicPassengerFactory::Generate(int curr_stop,
                                                     int last_stop) {
-  std::string new_name = NameGeneration();
+  int new_name = NameGeneration();
 
   // common use of random integer generation to determine
   //  what stop the passenger will depart the bus
@@ -65,23 +36,23 @@ Passenger * DeterministicPassengerFactory::Generate(int curr_stop,
   int destination = last_stop;
 #endif
 
-  return new Passenger(destination, new_name);
+  return PassengerPool::Acquire(destination, new_name);
 }
 
-std::string DeterministicPassengerFactory::NameGeneration() {
+// name is kept as a table id, the string is only built on Report()
+int DeterministicPassengerFactory::NameGeneration() {
   // assume rand is seeded
 #ifndef CONSTPASS
-  std::string name = std::string(NamePrefixArray[(dist(e) % 7)]) +
-                     std::string(NameStemsArray[(dist(e) % 20)]) +
-                     std::string(NameSuffixArray[(dist(e) % 16)]);
+  int prefix = dist(e) % PassengerNameTable::kNumPrefixes;
+  int stem = dist(e) % PassengerNameTable::kNumStems;
+  int suffix = dist(e) % PassengerNameTable::kNumSuffixes;
 #endif
 
 #ifdef CONSTPASS
-  std::string name = std::string(NamePrefixArray[4]) +
-                     std::string(NameStemsArray[7]) +
-                     std::string(NameSuffixArray[9]);
+  int prefix = 4;
+  int stem = 7;
+  int suffix = 9;
 #endif
 
-  name[0] = toupper(name[0]);  // don't forget to capitalize!
-  return name;
+  return PassengerNameTable::Compose(prefix, stem, suffix);
 }
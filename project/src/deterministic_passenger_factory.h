@@ -41,8 +41,8 @@ class DeterministicPassengerFactory {
  /**
   * @brief Generation of randomized passenger name from prefix, stems and suffixes.
   *
-  * @return Randomized passenger name.
+  * @return PassengerNameTable id of randomized passenger name.
   */
-  static std::string NameGeneration();
+  static int NameGeneration();
 };
 #endif  // SRC_DETERMINISTIC_PASSENGER_FACTORY_H_
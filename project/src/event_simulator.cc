@@ -0,0 +1,254 @@
+/**
+ * @file event_simulator.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+/*******************************************************************************
+* Includes
+******************************************************************************/
+#include "src/event_simulator.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "src/bus.h"
+#include "src/passenger_generator.h"
+#include "src/random_passenger_generator.h"
+#include "src/route.h"
+#include "src/stop.h"
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+EventSimulator::EventSimulator(ConfigManager* configM) {
+  configManager_ = configM;
+  numTimeSteps_ = 0;
+  simulationTimeElapsed_ = 0;
+  numBusses_ = 0;
+}
+
+EventSimulator::~EventSimulator() {
+  for (int i = 0; i < static_cast<int>(busses_.size()); i++) {
+    if (busses_[i] != NULL) {
+      busses_[i]->Reclaim();
+      delete busses_[i];
+    }
+  }
+}
+
+void EventSimulator::Start(const std::vector<int>& busStartTimings,
+                           const int& numTimeSteps) {
+  busStartTimings_ = busStartTimings;
+  numTimeSteps_ = numTimeSteps;
+  simulationTimeElapsed_ = 0;
+
+  prototypeRoutes_ = configManager_->GetRoutes();
+  for (int i = 0; i < static_cast<int>(prototypeRoutes_.size()); i++) {
+    if (reportLevel_ == kReportFull) {
+      prototypeRoutes_[i]->Report(std::cout);
+    }
+  }
+
+  const std::vector<Stop *>& stops = configManager_->GetStops();
+  for (int i = 0; i < static_cast<int>(stops.size()); i++) {
+    stopIndex_[stops[i]->GetId()] = i;
+  }
+  stopSynced_.assign(stops.size(), 0);
+
+  // every pair starts a bus in the first step, as the tick engine does
+  for (int i = 0; i < static_cast<int>(busStartTimings_.size()); i++) {
+    Push(1, kBusSpawn, i, i);
+  }
+
+  // stops that never get anyone draw no steps and are never scheduled
+  generators_ = configManager_->GetGenerators();
+  for (int i = 0; i < static_cast<int>(prototypeRoutes_.size()); i++) {
+    int num_stops = static_cast<int>(prototypeRoutes_[i]->GetStops().size());
+    for (int j = 0; j < num_stops; j++) {
+      ArrivalSource source;
+      source.route = i;
+      source.position = j;
+      arrivalSources_.push_back(source);
+      SchedulePassengers(0, static_cast<int>(arrivalSources_.size()) - 1);
+    }
+  }
+}
+
+void EventSimulator::Run() {
+  RunUntil(numTimeSteps_);
+
+  if (reportLevel_ == kReportFull) {
+    std::cout << "~~~~~~~~~~ The time is now " << simulationTimeElapsed_;
+    std::cout << "~~~~~~~~~~" << std::endl;
+    Report(std::cout);
+  } else if (reportLevel_ == kReportSummary) {
+    ReportSummary(std::cout);
+  }
+}
+
+void EventSimulator::RunUntil(int time) {
+  while (!events_.empty() && events_.top().time <= time) {
+    Event event = events_.top();
+    events_.pop();
+    switch (event.type) {
+      case kBusSpawn:
+        SpawnBus(event.time, event.index);
+        break;
+      case kPassengerArrival:
+        ArrivePassengers(event.time, event.index);
+        break;
+      default:
+        ArriveBus(event.time, event.index);
+        break;
+    }
+  }
+
+  // busses between stops have not moved since their last event
+  for (int i = 0; i < static_cast<int>(busses_.size()); i++) {
+    if (busses_[i] != NULL && busSynced_[i] < time) {
+      busses_[i]->UpdateTravel(time - busSynced_[i]);
+      busSynced_[i] = time;
+    }
+  }
+  if (time > simulationTimeElapsed_) {
+    simulationTimeElapsed_ = time;
+  }
+}
+
+void EventSimulator::SetReportLevel(ReportLevel level) {
+  reportLevel_ = level;
+  PassengerGenerator::SetReportLevel(level);
+}
+
+void EventSimulator::Report(std::ostream& out) {
+  const std::vector<Stop *>& stops = configManager_->GetStops();
+  for (int i = 0; i < static_cast<int>(stops.size()); i++) {
+    SyncStop(stops[i], simulationTimeElapsed_);
+  }
+  for (int i = 0; i < static_cast<int>(prototypeRoutes_.size()); i++) {
+    prototypeRoutes_[i]->Report(out);
+  }
+
+  // slots are reused, so newest first comes from the creation numbers
+  std::vector<std::pair<int, int>> running;
+  for (int i = 0; i < static_cast<int>(busses_.size()); i++) {
+    if (busses_[i] != NULL) {
+      running.push_back(std::make_pair(busRank_[i], i));
+    }
+  }
+  std::sort(running.rbegin(), running.rend());
+  for (int i = 0; i < static_cast<int>(running.size()); i++) {
+    busses_[running[i].second]->Report(out);
+  }
+}
+
+// counted the same way as ConfigurationSimulator so the lines compare
+void EventSimulator::ReportSummary(std::ostream& out) {
+  int num_waiting = 0;
+  const std::vector<Stop *>& stops = configManager_->GetStops();
+  for (int i = 0; i < static_cast<int>(stops.size()); i++) {
+    num_waiting += stops[i]->GetNumPassengers();
+  }
+
+  int num_riding = 0;
+  for (int i = 0; i < static_cast<int>(busses_.size()); i++) {
+    if (busses_[i] != NULL) {
+      num_riding += static_cast<int>(busses_[i]->GetNumPassengers());
+    }
+  }
+
+  out << "Time " << simulationTimeElapsed_ << ": " << numBusses_
+      << " busses, " << num_waiting << " waiting, " << num_riding
+      << " riding\n";
+}
+
+void EventSimulator::SpawnBus(int time, int pair) {
+  Route * outbound = prototypeRoutes_[2 * pair];
+  Route * inbound = prototypeRoutes_[2 * pair + 1];
+  int slot = static_cast<int>(busses_.size());
+  if (!freeSlots_.empty()) {
+    slot = freeSlots_.back();
+    freeSlots_.pop_back();
+  } else {
+    busses_.push_back(NULL);
+    busSynced_.push_back(0);
+    busRank_.push_back(0);
+  }
+  busses_[slot] = new Bus(std::to_string(busId), outbound->Clone(),
+                          inbound->Clone(), 60, 1);
+  busRank_[slot] = busId;
+  busId++;
+  numBusses_++;
+  // a new bus travels in the step it was made in
+  busSynced_[slot] = time - 1;
+  ScheduleArrival(slot);
+
+  // the tick engine counts down the interval and spawns one step after zero
+  int interval = busStartTimings_[pair] > 0 ? busStartTimings_[pair] : 0;
+  Push(time + interval + 1, kBusSpawn, pair, pair);
+}
+
+void EventSimulator::ArrivePassengers(int time, int source) {
+  const ArrivalSource& at = arrivalSources_[source];
+  Stop * stop = prototypeRoutes_[at.route]->GetStops()[at.position];
+  // the tick engine adds passengers before the step's update, which counts
+  // as their first step of waiting
+  SyncStop(stop, time - 1);
+  generators_[at.route]->GenerateArrivalsAt(at.position);
+  SchedulePassengers(time, source);
+}
+
+void EventSimulator::ArriveBus(int time, int slot) {
+  Bus * bus = busses_[slot];
+  bus->UpdateTravel(time - busSynced_[slot]);
+  // whoever boards has waited up to this step
+  SyncStop(bus->GetNextStop(), time);
+  bus->UpdateStop();
+  busSynced_[slot] = time;
+
+  if (bus->IsTripComplete()) {
+    bus->Reclaim();
+    delete bus;
+    busses_[slot] = NULL;
+    freeSlots_.push_back(slot);
+    numBusses_--;
+    return;
+  }
+  ScheduleArrival(slot);
+}
+
+void EventSimulator::SchedulePassengers(int time, int source) {
+  const ArrivalSource& at = arrivalSources_[source];
+  int steps = generators_[at.route]->StepsToNextArrival(at.position);
+  if (steps > 0) {
+    // sources are numbered in the order the tick engine generates them
+    Push(time + steps, kPassengerArrival, source, source);
+  }
+}
+
+void EventSimulator::ScheduleArrival(int slot) {
+  int ticks = busses_[slot]->GetTicksToNextStop();
+  if (ticks > 0) {
+    // newer busses visit first, as the tick engine walks busses backwards
+    Push(busSynced_[slot] + ticks, kBusArrival, -busRank_[slot], slot);
+  }
+}
+
+void EventSimulator::SyncStop(Stop * stop, int time) {
+  int index = stopIndex_[stop->GetId()];
+  if (stopSynced_[index] < time) {
+    stop->Advance(time - stopSynced_[index]);
+    stopSynced_[index] = time;
+  }
+}
+
+void EventSimulator::Push(int time, EventType type, int order, int index) {
+  Event event;
+  event.time = time;
+  event.type = type;
+  event.order = order;
+  event.index = index;
+  events_.push(event);
+}
@@ -0,0 +1,159 @@
+/**
+ * @file event_simulator.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_EVENT_SIMULATOR_H_
+#define SRC_EVENT_SIMULATOR_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <iostream>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+#include "src/config_manager.h"
+#include "src/report_level.h"
+
+class Route;
+class Bus;
+class RandomPassengerGenerator;
+class Stop;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Next-event version of ConfigurationSimulator for long headless runs.
+ *
+ * Instead of moving every bus every time step, each bus is scheduled for the
+ *  step it reaches its next stop and is left alone until then. Each stop of
+ *  each route is scheduled for its next step with arrivals, drawn from the
+ *  same per-step distribution the tick engine uses, and waiting passengers
+ *  are aged only when a bus boards them or a report reads them, so steps
+ *  with no events cost nothing. Busses move exactly as in the tick engine,
+ *  but passengers come from other draws of their generators, so the two
+ *  engines agree on a run's statistics rather than its passengers.
+ */
+class EventSimulator {
+ public:
+  /**
+  * @brief Constructs a simulator over the routes of a config.
+  * @param[in] ConfigManager * that has already read a config file.
+  *
+  */
+  explicit EventSimulator(ConfigManager*);
+  /**
+  * @brief Reclaims the busses still running.
+  *
+  */
+  ~EventSimulator();
+
+  /**
+  * @brief Schedules the first busses and each stop's first arrivals, like ConfigurationSimulator::Start().
+  * @param[in] vector<int> holding the interval between busses of each route pair.
+  * @param[in] int holding the number of time steps Run() simulates.
+  *
+  */
+  void Start(const std::vector<int>&, const int&);
+  /**
+  * @brief Runs every event up to the end of the simulation, then reports at the current level.
+  *
+  */
+  void Run();
+  /**
+  * @brief Runs every event up to and including a time step, then brings moving busses up to it.
+  * @param[in] int holding the time step to stop at.
+  *
+  */
+  void RunUntil(int);
+  /**
+  * @brief Sets how much Run() writes, including passenger generators.
+  * @param[in] ReportLevel to use from now on, kReportFull by default.
+  *
+  */
+  void SetReportLevel(ReportLevel);
+  /**
+  * @brief Writes every route, then every bus newest first, as ConfigurationSimulator::Report() does.
+  *
+  * Brings the waits of everyone at a stop up to the current step first.
+  *
+  * @param[in] ostream to write to.
+  *
+  */
+  void Report(std::ostream&);
+  /**
+  * @brief Writes one line with time, bus count, waiting and riding passengers.
+  * @param[in] ostream to write to.
+  *
+  */
+  void ReportSummary(std::ostream&);
+  int GetTime() const { return simulationTimeElapsed_; }
+
+ private:
+  // listed in the order the tick engine handles them within one step
+  enum EventType {
+    kBusSpawn,  ///< a route pair starts a new bus
+    kPassengerArrival,  ///< passengers arrive at one stop of one route
+    kBusArrival  ///< a bus reaches its next stop
+  };
+  struct Event {
+    int time;
+    EventType type;
+    int order;  ///< breaks ties within a step and type
+    int index;  ///< route pair for spawns, source for passengers, bus slot
+  };
+  /// a stop of a route, in the position its generator knows it by
+  struct ArrivalSource {
+    int route;
+    int position;
+  };
+  // std::priority_queue keeps the largest on top, so later events rank lower
+  struct LaterEvent {
+    bool operator()(const Event& a, const Event& b) const {
+      if (a.time != b.time) return a.time > b.time;
+      if (a.type != b.type) return a.type > b.type;
+      return a.order > b.order;
+    }
+  };
+
+  void SpawnBus(int time, int pair);
+  void ArrivePassengers(int time, int source);
+  void ArriveBus(int time, int slot);
+  void SchedulePassengers(int time, int source);
+  void ScheduleArrival(int slot);
+  void SyncStop(Stop * stop, int time);
+  void Push(int time, EventType type, int order, int index);
+
+  ConfigManager* configManager_;  ///< holds the routes to simulate
+
+  std::vector<int> busStartTimings_;  ///< interval between busses created
+  int numTimeSteps_;  ///< total time steps of simulation
+  int simulationTimeElapsed_;  ///< last time step fully simulated
+
+  std::vector<Route *> prototypeRoutes_;  ///< holds routes in config file
+  /// generator of each prototype route
+  std::vector<RandomPassengerGenerator *> generators_;
+  std::vector<ArrivalSource> arrivalSources_;  ///< by route, then position
+  std::unordered_map<int, int> stopIndex_;  ///< stop id to index in stops
+  std::vector<int> stopSynced_;  ///< last time step each stop was aged to
+
+  // slot per running bus, NULL once its trip is complete until a new bus
+  // takes it, so the slots only grow to the most busses out at once
+  std::vector<Bus *> busses_;
+  std::vector<int> busSynced_;  ///< last time step each bus was moved to
+  /// creation number of each slot's bus, ranking busses as the tick engine does
+  std::vector<int> busRank_;
+  std::vector<int> freeSlots_;  ///< slots emptied by completed busses
+  int numBusses_;  ///< busses still running
+
+  std::priority_queue<Event, std::vector<Event>, LaterEvent> events_;
+
+  int busId = 1000;  ///< starting index of bus
+  ReportLevel reportLevel_ = kReportFull;  ///< how much Run() writes
+};
+
+#endif  // SRC_EVENT_SIMULATOR_H_
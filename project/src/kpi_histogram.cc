@@ -0,0 +1,110 @@
+/**
+ * @file kpi_histogram.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+/*******************************************************************************
+* Includes
+******************************************************************************/
+#include "src/kpi_histogram.h"
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+KpiHistogram::KpiHistogram() : count_(0), sum_(0), min_(0), max_(0) {
+  for (int i = 0; i < kNumBuckets; i++) {
+    buckets_[i] = 0;
+  }
+}
+
+// a value of kExact or more keeps its top five bits: the leading one picks
+// the power of two, the four below it the bucket within
+int KpiHistogram::BucketOf(int64_t value) {
+  if (value < kExact) {
+    return static_cast<int>(value);
+  }
+  int shift = 0;
+  while ((value >> shift) >= kExact) {
+    shift++;
+  }
+  return kExact + (shift - 1) * kSubBuckets +
+         static_cast<int>((value >> shift) - kSubBuckets);
+}
+
+int64_t KpiHistogram::LowestIn(int bucket) {
+  if (bucket < kExact) {
+    return bucket;
+  }
+  int shift = (bucket - kExact) / kSubBuckets + 1;
+  int64_t top = kSubBuckets + (bucket - kExact) % kSubBuckets;
+  return top << shift;
+}
+
+int64_t KpiHistogram::HighestIn(int bucket) {
+  if (bucket < kExact) {
+    return bucket;
+  }
+  int shift = (bucket - kExact) / kSubBuckets + 1;
+  return LowestIn(bucket) + (static_cast<int64_t>(1) << shift) - 1;
+}
+
+void KpiHistogram::Record(int64_t value) {
+  if (value < 0) {
+    value = 0;
+  }
+  buckets_[BucketOf(value)]++;
+  if (count_ == 0 || value < min_) {
+    min_ = value;
+  }
+  if (value > max_) {
+    max_ = value;
+  }
+  count_++;
+  sum_ += value;
+}
+
+void KpiHistogram::Merge(const KpiHistogram& other) {
+  if (other.count_ == 0) {
+    return;
+  }
+  for (int i = 0; i < kNumBuckets; i++) {
+    buckets_[i] += other.buckets_[i];
+  }
+  if (count_ == 0 || other.min_ < min_) {
+    min_ = other.min_;
+  }
+  if (other.max_ > max_) {
+    max_ = other.max_;
+  }
+  count_ += other.count_;
+  sum_ += other.sum_;
+}
+
+int64_t KpiHistogram::GetPercentile(double percentile) const {
+  if (count_ == 0) {
+    return 0;
+  }
+  // rank of the sample wanted, counting from 1
+  int64_t rank = static_cast<int64_t>(percentile / 100 * count_ + .5);
+  if (rank < 1) {
+    rank = 1;
+  }
+  if (rank > count_) {
+    rank = count_;
+  }
+  int64_t seen = 0;
+  for (int i = 0; i < kNumBuckets; i++) {
+    seen += buckets_[i];
+    if (seen >= rank) {
+      int64_t middle = LowestIn(i) + (HighestIn(i) - LowestIn(i)) / 2;
+      // the ends are known exactly, so never answer outside them
+      return middle < min_ ? min_ : (middle > max_ ? max_ : middle);
+    }
+  }
+  return max_;
+}
+
+double KpiHistogram::GetMean() const {
+  return count_ > 0 ? static_cast<double>(sum_) / count_ : 0;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file kpi_histogram.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_KPI_HISTOGRAM_H_
+#define SRC_KPI_HISTOGRAM_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Fixed-size histogram of non-negative whole numbers, for percentiles over any number of samples.
+ *
+ * Values below kExact get a bucket each. Above that, every power of two is split
+ *  into kExact / 2 buckets, so a percentile is within about 3% of the true value
+ *  however large it is, in the manner of an HDR histogram. Count, mean, minimum
+ *  and maximum are exact. Memory does not grow with the number of samples.
+ */
+class KpiHistogram {
+ public:
+  KpiHistogram();
+
+  /**
+  * @brief Adds one sample.
+  * @param[in] int64_t holding the value, negative values count as 0.
+  *
+  */
+  void Record(int64_t);
+  /**
+  * @brief Adds every sample of another histogram, as if recorded here.
+  * @param[in] KpiHistogram to add.
+  *
+  */
+  void Merge(const KpiHistogram&);
+  /**
+  * @brief Returns a value at or above the given share of samples.
+  * @param[in] double holding the percentile, from 0 to 100.
+  * @return int64_t in the middle of the bucket holding that percentile, 0 if empty.
+  *
+  */
+  int64_t GetPercentile(double) const;
+  double GetMean() const;
+  int64_t GetCount() const { return count_; }
+  int64_t GetMin() const { return count_ > 0 ? min_ : 0; }
+  int64_t GetMax() const { return max_; }
+
+ private:
+  static const int kExact = 32;  ///< values with a bucket of their own
+  static const int kSubBuckets = kExact / 2;  ///< buckets per power of two
+  static const int kNumBuckets = kExact + 58 * kSubBuckets;
+
+  static int BucketOf(int64_t);
+  static int64_t LowestIn(int);
+  static int64_t HighestIn(int);
+
+  int64_t buckets_[kNumBuckets];
+  int64_t count_;
+  int64_t sum_;
+  int64_t min_;
+  int64_t max_;
+};
+
+#endif  // SRC_KPI_HISTOGRAM_H_
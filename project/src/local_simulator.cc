@@ -180,8 +180,20 @@ bool LocalSimulator::Start() {
   prototype_routes_.push_back(CC_EB);
   prototype_routes_.push_back(CC_WB);
 
-  prototype_routes_[0]->Report(std::cout);
-  prototype_routes_[1]->Report(std::cout);
+  if (report_level_ == kReportFull) {
+    prototype_routes_[0]->Report(std::cout);
+    prototype_routes_[1]->Report(std::cout);
+  }
+  if (trace_) {
+    prototype_routes_[0]->Trace(trace_);
+    prototype_routes_[1]->Trace(trace_);
+  }
+  if (web_interface_) {
+    for (int i = 0; i < 2; i++) {
+      prototype_routes_[i]->UpdateRouteData();
+      web_interface_->UpdateRoute(prototype_routes_[i]->GetRouteData());
+    }
+  }
 
   bus_counters_.push_back(10000);
 
@@ -199,8 +211,13 @@ bool LocalSimulator::Start() {
 bool LocalSimulator::Update() {
   // increase time
   simulation_time_elapsed_++;
-  std::cout << "~~~~~~~~~~~~~ The time is now " << simulation_time_elapsed_;
-  std::cout << " ~~~~~~~~~~~~~" << std::endl;
+  if (report_level_ == kReportFull) {
+    std::cout << "~~~~~~~~~~~~~ The time is now " << simulation_time_elapsed_;
+    std::cout << " ~~~~~~~~~~~~~" << std::endl;
+  }
+  if (trace_) {
+    trace_->WriteTick(simulation_time_elapsed_);
+  }
 
   // various route-indexed list iterators
   std::vector<int>::iterator bus_gen_timing_iter = bus_start_timings_.begin();
@@ -241,7 +258,16 @@ bool LocalSimulator::Update() {
     // update bus
     (*bus_iter)->Update();
     // bus report
-    (*bus_iter)->Report(std::cout);
+    if (report_level_ == kReportFull) {
+      (*bus_iter)->Report(std::cout);
+    }
+    if (trace_) {
+      (*bus_iter)->Trace(trace_);
+    }
+    // Update() already refreshed the bus's data
+    if (web_interface_) {
+      web_interface_->UpdateBus((*bus_iter)->GetBusData());
+    }
 
     // REQUIRES USE OF IsTripComplete, which was not required
     // Buses which are "done" will just keep having Update() called
@@ -258,7 +284,19 @@ bool LocalSimulator::Update() {
       route_iter != prototype_routes_.end(); route_iter++) {
     // update stop
     (*route_iter)->Update();
-    (*route_iter)->Report(std::cout);
+    if (report_level_ == kReportFull) {
+      (*route_iter)->Report(std::cout);
+    }
+    if (trace_) {
+      (*route_iter)->Trace(trace_);
+    }
+    if (web_interface_) {
+      web_interface_->UpdateRoute((*route_iter)->GetRouteData());
+    }
+  }
+
+  if (report_level_ == kReportSummary) {
+    ReportSummary(std::cout, simulation_time_elapsed_);
   }
 
   return true;
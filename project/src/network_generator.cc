@@ -0,0 +1,86 @@
+/**
+ * @file network_generator.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+/*******************************************************************************
+* Includes
+******************************************************************************/
+#include "src/network_generator.h"
+
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+// around campus, with lines a few blocks apart and stops about a quarter
+// mile apart along them
+static const double kBaseLatitude = 44.96;
+static const double kBaseLongitude = -93.25;
+static const double kLineSpacing = .002;
+static const double kStopSpacing = .005;
+
+static bool IsTransfer(const NetworkShape& shape, int stop) {
+  return shape.transfer_every > 0 && stop % shape.transfer_every == 0;
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+std::string NetworkGenerator::Generate(const NetworkShape& shape) {
+  std::mt19937 rand(shape.seed);
+  std::uniform_real_distribution<double> probability(shape.min_probability,
+                                                     shape.max_probability);
+  // the avenue crosses the middle of the lines
+  double avenue_latitude = kBaseLatitude +
+                           kLineSpacing * (shape.num_lines - 1) / 2;
+
+  std::ostringstream out;
+  out.precision(8);
+  for (int line = 0; line < shape.num_lines; line++) {
+    std::vector<std::string> names(shape.num_stops);
+    std::vector<double> latitudes(shape.num_stops);
+    std::vector<double> longitudes(shape.num_stops);
+    for (int i = 0; i < shape.num_stops; i++) {
+      if (IsTransfer(shape, i)) {
+        names[i] = "Transfer " + std::to_string(i);
+        latitudes[i] = avenue_latitude;
+      } else {
+        names[i] = "Line " + std::to_string(line) + " Stop " +
+                   std::to_string(i);
+        latitudes[i] = kBaseLatitude + kLineSpacing * line;
+      }
+      longitudes[i] = kBaseLongitude + kStopSpacing * i;
+    }
+
+    out << "ROUTE_GENERAL, Line " << line << "\n\n";
+    out << "Stop Name, Long, Lat, Pass Gen Prob\n\n";
+    for (int direction = 0; direction < 2; direction++) {
+      out << "ROUTE, " << (direction == 0 ? "East Bound" : "West Bound");
+      out << "\n\n";
+      for (int j = 0; j < shape.num_stops; j++) {
+        int i = direction == 0 ? j : shape.num_stops - 1 - j;
+        out << "STOP, " << names[i] << ", " << latitudes[i] << ", "
+            << longitudes[i] << ", ";
+        if (j < shape.num_stops - 1) {
+          out << probability(rand) << "\n";
+        } else {
+          out << "0\n";
+        }
+      }
+      out << "\n";
+    }
+  }
+  return out.str();
+}
+
+bool NetworkGenerator::Write(const std::string& filename,
+                             const NetworkShape& shape) {
+  std::ofstream out("config/" + filename, std::ios::binary);
+  out << Generate(shape);
+  return static_cast<bool>(out);
+}
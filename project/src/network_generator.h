@@ -0,0 +1,60 @@
+/**
+ * @file network_generator.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_NETWORK_GENERATOR_H_
+#define SRC_NETWORK_GENERATOR_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Size and busyness of a synthetic network.
+ *
+ * The defaults are close to config/config.txt: one line of nine stops.
+ */
+struct NetworkShape {
+  int num_lines = 1;  ///< route pairs, each an outbound and an inbound route
+  int num_stops = 9;  ///< stops on every route
+  double min_probability = .01;  ///< least passenger generation probability
+  double max_probability = .3;  ///< greatest passenger generation probability
+  int transfer_every = 0;  ///< every nth stop is shared by all lines, 0 for none
+  unsigned int seed = 1;  ///< picks the probabilities
+};
+
+/**
+ * @brief Writes synthetic networks in the format ConfigManager reads.
+ *
+ * Every line runs east along its own street with stops a few blocks apart,
+ *  then back west through the same stops, as the Campus Connector does. The
+ *  last stop of each route generates no one. Transfer stops sit on a shared
+ *  avenue and are listed by every line, so ConfigManager builds them once.
+ *  The same shape always gives the same text.
+ */
+class NetworkGenerator {
+ public:
+  /**
+  * @brief Builds the config text for a network.
+  * @param[in] NetworkShape holding sizes, probabilities and seed.
+  * @return string ready for ConfigManager::ParseConfig().
+  *
+  */
+  static std::string Generate(const NetworkShape&);
+  /**
+  * @brief Writes the config text for a network to config/<filename>.
+  * @param[in] string holding file name inside the config directory.
+  * @param[in] NetworkShape holding sizes, probabilities and seed.
+  * @return bool false if the file could not be written.
+  *
+  */
+  static bool Write(const std::string&, const NetworkShape&);
+};
+
+#endif  // SRC_NETWORK_GENERATOR_H_
@@ -12,32 +12,73 @@
 #include <iostream>
 #include <string>
 
+#include "src/passenger_name_table.h"
+#include "src/trace_writer.h"
+
 
 int Passenger::count_ = 0;
 
 // Passenger::Passenger(Stop * dest = NULL, std::string name = "Nobody") {
 Passenger::Passenger(int destination_stop_id, std::string name):
-            name_(name), destination_stop_id_(destination_stop_id),
-                wait_at_stop_(0), time_on_bus_(0), id_(count_) {
+            name_id_(PassengerNameTable::Intern(name)),
+            destination_stop_id_(destination_stop_id),
+                wait_at_stop_(0), time_on_bus_(0), clock_(NULL),
+                clock_start_(0), id_(count_) {
+  count_++;
+}
+
+// used by the factories, which never build the name string
+Passenger::Passenger(int destination_stop_id, int name_id):
+            name_id_(name_id), destination_stop_id_(destination_stop_id),
+                wait_at_stop_(0), time_on_bus_(0), clock_(NULL),
+                clock_start_(0), id_(count_) {
   count_++;
 }
 
-void Passenger::Update() {
+void Passenger::Update(int ticks) {
   if (IsOnBus()) {
-    time_on_bus_++;
+    time_on_bus_ += ticks;
   } else {
-    wait_at_stop_++;
+    wait_at_stop_ += ticks;
   }
 }
 
+void Passenger::SetClock(const int * clock) {
+  Bank();
+  clock_ = clock;
+  if (clock_ != NULL) {
+    clock_start_ = *clock_;
+  }
+}
+
+// time on the clock so far goes to wherever the passenger has been
+void Passenger::Bank() {
+  int elapsed = GetClockTime();
+  if (IsOnBus()) {
+    time_on_bus_ += elapsed;
+  } else {
+    wait_at_stop_ += elapsed;
+  }
+  clock_start_ += elapsed;
+}
+
+int Passenger::GetClockTime() const {
+  if (clock_ == NULL) {
+    return 0;
+  }
+  return *clock_ - clock_start_;
+}
+
 void Passenger::GetOnBus() {
+  // the wait so far was at the stop
+  Bank();
   if (time_on_bus_ == 0) {
      time_on_bus_ = 1;
   }
 }
 
 int Passenger::GetTotalWait() const {
-  return wait_at_stop_ + time_on_bus_;
+  return wait_at_stop_ + time_on_bus_ + GetClockTime();
 }
 
 bool Passenger::IsOnBus() const {
@@ -52,9 +93,22 @@ int Passenger::GetDestination() const {
 }
 
 void Passenger::Report() const {
-  std::cout << "Name: " << name_ << std::endl;
-  std::cout << "Destination: " << destination_stop_id_ << std::endl;
-  std::cout << "Total Wait: " << GetTotalWait() << std::endl;
-  std::cout << "\tWait at Stop: " << wait_at_stop_ << std::endl;
-  std::cout << "\tTime on bus: " << time_on_bus_ << std::endl;
+  std::cout << "Name: " << PassengerNameTable::GetName(name_id_) << "\n";
+  std::cout << "Destination: " << destination_stop_id_ << "\n";
+  std::cout << "Total Wait: " << GetTotalWait() << "\n";
+  std::cout << "\tWait at Stop: " << GetWaitAtStop() << "\n";
+  std::cout << "\tTime on bus: " << GetTimeOnBus() << "\n";
+}
+
+void Passenger::Trace(TraceWriter * trace) const {
+  trace->WritePassenger(name_id_, destination_stop_id_, GetWaitAtStop(),
+                        GetTimeOnBus());
+}
+
+int Passenger::GetWaitAtStop() const {
+  return IsOnBus() ? wait_at_stop_ : wait_at_stop_ + GetClockTime();
+}
+
+int Passenger::GetTimeOnBus() const {
+  return IsOnBus() ? time_on_bus_ + GetClockTime() : time_on_bus_;
 }
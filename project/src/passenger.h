@@ -14,6 +14,8 @@
 #include <iostream>
 #include <string>
 
+class TraceWriter;
+
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
@@ -22,6 +24,9 @@
  *
  * Holds information about name of passenger and what stop they are trying to end at.
  *  Also holds methods to find if they are on stop or bus and how long they've been waiting at each.
+ *  The stop or bus holding a passenger owns a clock of its updates; the passenger notes
+ *  the reading when it joins and works out its time from it on demand, so neither
+ *  container has to touch every passenger each time step.
  */
 class Passenger {  // : public Reporter {
  public:
@@ -35,10 +40,28 @@ class Passenger {  // : public Reporter {
   */
   explicit Passenger(int = -1, std::string = "Nobody");
   /**
+  * @brief Constructs a passenger whose name is already an id in PassengerNameTable.
+  *
+  *
+  * @param[in] int holding an id number
+  * @param[in] int holding PassengerNameTable id of passenger's name
+  *
+  */
+  Passenger(int, int);
+  /**
   * @brief Updates wait_at_stop_ or time_on_bus_ depending if passenger is on stop or bus.
+  * @param[in] int holding how many time steps passed, one by default.
   *
   */
-  void Update();
+  void Update(int = 1);
+  /**
+  * @brief Starts timing the passenger from the update clock of the stop or bus now holding it.
+  *
+  * Time counted on the previous clock is kept. NULL stops the clock.
+  *
+  * @param[in] const int * holding the clock, which must outlive the stay.
+  */
+  void SetClock(const int *);
   /**
   * @brief Updates wait_at_stop_ to flag that passenger is now on bus and not at stop.
   *
@@ -51,6 +74,18 @@ class Passenger {  // : public Reporter {
   */
   int GetTotalWait() const;
   /**
+  * @brief Returns time waited at stops.
+  * @return int of time units.
+  *
+  */
+  int GetWaitAtStop() const;
+  /**
+  * @brief Returns time spent on the bus.
+  * @return int of time units.
+  *
+  */
+  int GetTimeOnBus() const;
+  /**
   * @brief Returns true if time_on_bus is greater than 0, false otherwise.
   * @return bool indicating if passenger is on bus.
   * 
@@ -67,12 +102,32 @@ class Passenger {  // : public Reporter {
   *
   */
   void Report() const;
+  /**
+  * @brief Records what Report() prints to a binary trace.
+  * @param[in] TraceWriter * receiving the record.
+  *
+  */
+  void Trace(TraceWriter *) const;
 
  private:
-  std::string name_;  ///< Name of passenger.
+  int name_id_;  ///< PassengerNameTable id of name, built on Report().
   int destination_stop_id_;  ///< ID of stop passenger will exit bus at.
-  int wait_at_stop_;  ///< Total time units passenger has been at stop.
-  int time_on_bus_;  ///< Total time units passenger has been on the bus.
+  /**
+  * @brief Moves the time on clock_ since clock_start_ into wait_at_stop_ or time_on_bus_.
+  *
+  */
+  void Bank();
+  /**
+  * @brief Returns the time counted on clock_ and not banked yet.
+  * @return int of time steps.
+  *
+  */
+  int GetClockTime() const;
+
+  int wait_at_stop_;  ///< Time units at stop, besides GetClockTime().
+  int time_on_bus_;  ///< Time units on the bus, besides GetClockTime().
+  const int * clock_;  ///< update clock of the stop or bus holding passenger
+  int clock_start_;  ///< reading of clock_ when passenger joined
   int id_;
   static int count_;   // global count, used to set ID for new instances
 };
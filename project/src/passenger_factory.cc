@@ -6,42 +6,12 @@
 #include <random>
 #include <string>
 #include "src/passenger_factory.h"
+#include "src/passenger_name_table.h"
+#include "src/passenger_pool.h"
 
 std::random_device dev;
 std::mt19937 e(dev());
-std::uniform_int_distribution<std::mt19937::result_type> dist(1, 1000);
-
-
-// Here I will create an array of prefixes to help generate names.
-// I am banking on multiplication to ensure a large number of names
-// by using 7 prefixes and 20 stems, and 16 suffixes I should be able to
-// create about 7 * 20 * 16 = 2240 names out of 312 bytes of data (In my earlier
-// example from the forum I used this code to generate male and female names,
-// but here I combined them).
-
-static const char* NamePrefixArray[7] = {
-"",  // who said we need to add a prefix?
-"bel",  // lets say that means "the good"
-"nar",  // "The not so good as Bel"
-"xan",  //" The evil"
-"bell",  // "the good"
-"natr",  // "the neutral/natral"
-"ev",  // Man am I original
-};
-
-static const char* NameSuffixArray[16] = {
-"", "us", "ix", "ox", "ith",
-"ath", "um", "ator", "or", "axia",
-"imus", "ais", "itur", "orex", "o",
-"y"
-};
-
-static const char* NameStemsArray[20] = {
-"adur", "aes", "anim", "apoll", "imac",
-"educ", "equis", "extr", "guius", "hann",
-"equi", "amora", "hum", "iace", "ille",
-"inept", "iuv", "obe", "ocul", "orbis"
-};
+
 
 /*******************************************************************************
  * Member Functions
@@ -49,36 +19,66 @@ static const char* NameStemsArray[20] = {
 // Code for name generation adapted from:
 // https://www.dreamincode.net/forums/topic/27024-data-modeling-for-games-in-c-part-ii/
 Passenger * PassengerFactory::Generate(int curr_stop, int last_stop) {
-  std::string new_name = NameGeneration();
+  return Generate(curr_stop, last_stop, &e);
+}
+
+Passenger * PassengerFactory::Generate(int curr_stop, int last_stop,
+                                       std::mt19937 * rand) {
+  // local distribution so concurrent callers share no state
+  std::uniform_int_distribution<std::mt19937::result_type> pick(1, 1000);
+  int new_name = NameGeneration(rand);
 
   // common use of random integer generation to determine
   //  what stop the passenger will depart the bus
 
 #ifndef CONSTPASS
-  int destination = (dist(e) % (last_stop - curr_stop)) + curr_stop + 1;
+  int destination = (pick(*rand) % (last_stop - curr_stop)) + curr_stop + 1;
 #endif
 
 #ifdef CONSTPASS
   int destination = last_stop;
 #endif
 
-  return new Passenger(destination, new_name);
+  return PassengerPool::Acquire(destination, new_name);
+}
+
+Passenger * PassengerFactory::Generate(const std::vector<int>& stop_ids,
+                                       int curr_index, std::mt19937 * rand) {
+  std::uniform_int_distribution<std::mt19937::result_type> pick(1, 1000);
+  int new_name = NameGeneration(rand);
+  int last_index = static_cast<int>(stop_ids.size()) - 1;
+
+  // nowhere left to go from the last stop, avoid dividing by zero
+  if (curr_index >= last_index) {
+    return PassengerPool::Acquire(stop_ids[last_index], new_name);
+  }
+
+#ifndef CONSTPASS
+  int destination = (pick(*rand) % (last_index - curr_index)) + curr_index + 1;
+#endif
+
+#ifdef CONSTPASS
+  int destination = last_index;
+#endif
+
+  return PassengerPool::Acquire(stop_ids[destination], new_name);
 }
 
-std::string PassengerFactory::NameGeneration() {
+// name is kept as a table id, the string is only built on Report()
+int PassengerFactory::NameGeneration(std::mt19937 * rand) {
   // assume rand is seeded
+  std::uniform_int_distribution<std::mt19937::result_type> pick(1, 1000);
 #ifndef CONSTPASS
-  std::string name = std::string(NamePrefixArray[(dist(e) % 7)]) +
-                     std::string(NameStemsArray[(dist(e) % 20)]) +
-                     std::string(NameSuffixArray[(dist(e) % 16)]);
+  int prefix = pick(*rand) % PassengerNameTable::kNumPrefixes;
+  int stem = pick(*rand) % PassengerNameTable::kNumStems;
+  int suffix = pick(*rand) % PassengerNameTable::kNumSuffixes;
 #endif
 
 #ifdef CONSTPASS
-  std::string name = std::string(NamePrefixArray[4]) +
-                     std::string(NameStemsArray[7]) +
-                     std::string(NameSuffixArray[9]);
+  int prefix = 4;
+  int stem = 7;
+  int suffix = 9;
 #endif
 
-  name[0] = toupper(name[0]);  // don't forget to capitalize!
-  return name;
+  return PassengerNameTable::Compose(prefix, stem, suffix);
 }
@@ -11,7 +11,9 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <random>
 #include <string>
+#include <vector>
 
 #include "src/passenger.h"
 
@@ -37,12 +39,39 @@ class PassengerFactory {
   * @return Passenger object with name and destination.
   */
   static Passenger * Generate(int, int);
+ /**
+  * @brief Same as Generate(int, int), drawing from the caller's random stream instead of the shared one.
+  *
+  * Lets each PassengerGenerator keep its own stream so generation is reproducible
+  *  and safe to run for several routes at once.
+  *
+  * @param[in] curr_stop Current stop, left bound (not-inclusive)
+  * @param[in] last_stop Last stop, right bound (inclusive)
+  * @param[in] rand Random stream to draw name and destination from
+  *
+  * @return Passenger object with name and destination.
+  */
+  static Passenger * Generate(int, int, std::mt19937 *);
+ /**
+  * @brief Same draws as Generate(int, int, std::mt19937 *), but over positions along a route.
+  *
+  * Stops shared between routes keep one id, so the ids along a route are not
+  *  consecutive. The destination is picked among the later positions and then
+  *  looked up, which gives the same passenger as the id version whenever the ids are consecutive.
+  *
+  * @param[in] stop_ids Id of each stop on the route, in order
+  * @param[in] curr_index Position of current stop on the route
+  * @param[in] rand Random stream to draw name and destination from
+  *
+  * @return Passenger object with name and destination.
+  */
+  static Passenger * Generate(const std::vector<int>&, int, std::mt19937 *);
  private:
  /**
   * @brief Generation of randomized passenger name from prefix, stems and suffixes.
   *
-  * @return Randomized passenger name.
+  * @return PassengerNameTable id of randomized passenger name.
   */
-  static std::string NameGeneration();
+  static int NameGeneration(std::mt19937 *);
 };
 #endif  // SRC_PASSENGER_FACTORY_H_
@@ -8,8 +8,30 @@
 
 #include "src/passenger.h"
 
+ReportLevel PassengerGenerator::report_level_ = kReportFull;
+
 PassengerGenerator::PassengerGenerator(std::list<double> probs,
    std::list<Stop *> stops) {
   generation_probabilities_ = probs;
   stops_ = stops;
+  for (std::list<Stop *>::iterator it = stops_.begin(); it != stops_.end();
+       it++) {
+    stop_ids_.push_back((*it)->GetId());
+  }
+}
+
+void PassengerGenerator::SetReportLevel(ReportLevel level) {
+  report_level_ = level;
+}
+
+void PassengerGenerator::SetStopQueues(const std::vector<int>& queues) {
+  stop_queues_ = queues;
+}
+
+// a generator used without a route adds to each stop's first queue
+int PassengerGenerator::GetStopQueue(int index) const {
+  if (index < static_cast<int>(stop_queues_.size())) {
+    return stop_queues_[index];
+  }
+  return 0;
 }
@@ -8,7 +8,9 @@
 #define SRC_PASSENGER_GENERATOR_H_
 
 #include <list>
+#include <vector>
 #include "src/passenger_factory.h"
+#include "src/report_level.h"
 #include "src/stop.h"
 
 class Stop;  // forward declaration
@@ -16,11 +18,22 @@ class Stop;  // forward declaration
 class PassengerGenerator {
  public:
   PassengerGenerator(std::list<double>, std::list<Stop *>);
+  virtual ~PassengerGenerator() {}
   // Makes the class abstract, cannot instantiate and forces subclass override
   virtual int GeneratePassengers() = 0;  // pure virtual
+  // generators print only at kReportFull, shared by every generator
+  static void SetReportLevel(ReportLevel);
+  // queue each stop keeps for this generator's route, set by RouteTopology
+  void SetStopQueues(const std::vector<int>&);
  protected:
+  // queue to add passengers to at the stop in the given position
+  int GetStopQueue(int) const;
+
   std::list<double> generation_probabilities_;
   std::list<Stop *> stops_;
+  std::vector<int> stop_ids_;  // ids of stops_ in order, for destinations
+  std::vector<int> stop_queues_;  // empty until a route claims the generator
+  static ReportLevel report_level_;
 
   // should we be using a singleton here somehow?
   // PassengerFactory * pass_factory;
@@ -0,0 +1,85 @@
+/**
+ * @file passenger_name_table.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+/*******************************************************************************
+* Includes
+******************************************************************************/
+#include "src/passenger_name_table.h"
+
+#include <cctype>
+
+const int PassengerNameTable::kNumPrefixes;
+const int PassengerNameTable::kNumStems;
+const int PassengerNameTable::kNumSuffixes;
+const int PassengerNameTable::kNumGeneratedNames;
+
+std::vector<std::string> PassengerNameTable::interned_names_;
+std::unordered_map<std::string, int> PassengerNameTable::interned_ids_;
+
+// Here I will create an array of prefixes to help generate names.
+// I am banking on multiplication to ensure a large number of names
+// by using 7 prefixes and 20 stems, and 16 suffixes I should be able to
+// create about 7 * 20 * 16 = 2240 names out of 312 bytes of data (In my earlier
+// example from the forum I used this code to generate male and female names,
+// but here I combined them).
+
+static const char* NamePrefixArray[PassengerNameTable::kNumPrefixes] = {
+"",  // who said we need to add a prefix?
+"bel",  // lets say that means "the good"
+"nar",  // "The not so good as Bel"
+"xan",  //" The evil"
+"bell",  // "the good"
+"natr",  // "the neutral/natral"
+"ev",  // Man am I original
+};
+
+static const char* NameSuffixArray[PassengerNameTable::kNumSuffixes] = {
+"", "us", "ix", "ox", "ith",
+"ath", "um", "ator", "or", "axia",
+"imus", "ais", "itur", "orex", "o",
+"y"
+};
+
+static const char* NameStemsArray[PassengerNameTable::kNumStems] = {
+"adur", "aes", "anim", "apoll", "imac",
+"educ", "equis", "extr", "guius", "hann",
+"equi", "amora", "hum", "iace", "ille",
+"inept", "iuv", "obe", "ocul", "orbis"
+};
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+// pack indices as prefix-major so ids cover 0 .. kNumGeneratedNames - 1
+int PassengerNameTable::Compose(int prefix, int stem, int suffix) {
+  return (prefix * kNumStems + stem) * kNumSuffixes + suffix;
+}
+
+int PassengerNameTable::Intern(const std::string& name) {
+  std::unordered_map<std::string, int>::iterator it = interned_ids_.find(name);
+  if (it != interned_ids_.end()) {
+    return it->second;
+  }
+  int id = kNumGeneratedNames + static_cast<int>(interned_names_.size());
+  interned_names_.push_back(name);
+  interned_ids_[name] = id;
+  return id;
+}
+
+std::string PassengerNameTable::GetName(int id) {
+  if (id >= kNumGeneratedNames) {
+    return interned_names_[id - kNumGeneratedNames];
+  }
+  int suffix = id % kNumSuffixes;
+  int stem = (id / kNumSuffixes) % kNumStems;
+  int prefix = id / (kNumSuffixes * kNumStems);
+  std::string name = std::string(NamePrefixArray[prefix]) +
+                     std::string(NameStemsArray[stem]) +
+                     std::string(NameSuffixArray[suffix]);
+
+  name[0] = toupper(name[0]);  // don't forget to capitalize!
+  return name;
+}
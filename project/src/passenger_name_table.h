@@ -0,0 +1,68 @@
+/**
+ * @file passenger_name_table.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_PASSENGER_NAME_TABLE_H_
+#define SRC_PASSENGER_NAME_TABLE_H_
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Maps passenger names to small integer ids so passengers do not each hold a string.
+ *
+ * Generated names are built from a prefix, a stem and a suffix, so their id is
+ *  just the three indices packed together and no string exists until \ref GetName
+ *  is called. Any other name is interned once and given an id past the generated ones.
+ *  Like PassengerFactory, every call is static.
+ */
+class PassengerNameTable {
+ public:
+  static const int kNumPrefixes = 7;  ///< entries in the prefix array
+  static const int kNumStems = 20;  ///< entries in the stem array
+  static const int kNumSuffixes = 16;  ///< entries in the suffix array
+  /// number of ids reserved for generated names (7 * 20 * 16 = 2240)
+  static const int kNumGeneratedNames = kNumPrefixes * kNumStems * kNumSuffixes;
+
+ /**
+  * @brief Returns id of a generated name without building the string.
+  *
+  * @param[in] int index into the prefix array.
+  * @param[in] int index into the stem array.
+  * @param[in] int index into the suffix array.
+  *
+  * @return int id of the generated name.
+  */
+  static int Compose(int, int, int);
+ /**
+  * @brief Returns id of an arbitrary name, adding it to the table the first time it is seen.
+  *
+  * @param[in] string holding name.
+  *
+  * @return int id of the name.
+  */
+  static int Intern(const std::string&);
+ /**
+  * @brief Builds the name belonging to an id from \ref Compose or \ref Intern.
+  *
+  * @param[in] int id of name.
+  *
+  * @return Capitalized generated name, or the interned string.
+  */
+  static std::string GetName(int);
+
+ private:
+  static std::vector<std::string> interned_names_;  ///< names by id - 2240
+  static std::unordered_map<std::string, int> interned_ids_;  ///< reverse
+};
+#endif  // SRC_PASSENGER_NAME_TABLE_H_
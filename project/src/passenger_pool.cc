@@ -0,0 +1,59 @@
+/**
+ * @file passenger_pool.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+/*******************************************************************************
+* Includes
+******************************************************************************/
+#include "src/passenger_pool.h"
+
+#include <new>
+
+std::vector<void *> PassengerPool::chunks_;
+std::vector<Passenger *> PassengerPool::free_list_;
+int PassengerPool::next_in_chunk_ = kChunkSize;  // forces first chunk
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+// routes may generate passengers on several threads at once, so the
+// arena and free list are only touched inside one critical section
+Passenger * PassengerPool::Acquire(int destination, int name_id) {
+  Passenger * pass;
+  #pragma omp critical(passenger_pool)
+  {
+    void * slot;
+    // reuse a released slot before growing the arena
+    if (!free_list_.empty()) {
+      slot = free_list_.back();
+      free_list_.pop_back();
+    } else {
+      if (next_in_chunk_ == kChunkSize) {
+        chunks_.push_back(::operator new(sizeof(Passenger) * kChunkSize));
+        next_in_chunk_ = 0;
+      }
+      slot = static_cast<Passenger *>(chunks_.back()) + next_in_chunk_;
+      next_in_chunk_++;
+    }
+    pass = new (slot) Passenger(destination, name_id);
+  }
+  return pass;
+}
+
+void PassengerPool::Release(Passenger * pass) {
+  // destroy now so the name is freed, slot is rebuilt in Acquire()
+  pass->~Passenger();
+  #pragma omp critical(passenger_pool)
+  free_list_.push_back(pass);
+}
+
+int PassengerPool::GetNumAllocated() {
+  return static_cast<int>(chunks_.size()) * kChunkSize
+         - (kChunkSize - next_in_chunk_);
+}
+
+int PassengerPool::GetNumFree() {
+  return static_cast<int>(free_list_.size());
+}
@@ -0,0 +1,65 @@
+/**
+ * @file passenger_pool.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_PASSENGER_POOL_H_
+#define SRC_PASSENGER_POOL_H_
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <vector>
+
+#include "src/passenger.h"
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Arena allocator that hands out and recycles Passenger objects.
+ *
+ * Passengers are carved out of large chunks instead of being allocated one at a time,
+ *  and passengers that have left their bus are returned with \ref Release so their
+ *  slot is reused by the next \ref Acquire. Like PassengerFactory, every call is static.
+ */
+class PassengerPool {
+ public:
+ /**
+  * @brief Returns a passenger constructed in a recycled or fresh arena slot.
+  *
+  * @param[in] int holding destination stop id of passenger.
+  * @param[in] int holding PassengerNameTable id of passenger's name.
+  *
+  * @return Passenger * owned by the pool until released.
+  */
+  static Passenger * Acquire(int, int);
+ /**
+  * @brief Destroys a passenger that is done with the simulation and keeps its memory for reuse.
+  *
+  * The pool takes ownership of the passenger, which may be one from \ref Acquire
+  *  or one created with new. The pointer must not be used after this call.
+  *
+  * @param[in] Passenger * leaving the simulation.
+  */
+  static void Release(Passenger *);
+ /**
+  * @brief Returns number of arena slots carved out so far.
+  * @return int count of slots, whether in use or free.
+  */
+  static int GetNumAllocated();
+ /**
+  * @brief Returns number of released slots waiting to be reused.
+  * @return int count of free slots.
+  */
+  static int GetNumFree();
+
+ private:
+  static const int kChunkSize = 4096;  ///< passengers per arena chunk
+  static std::vector<void *> chunks_;  ///< raw arena storage, never shrinks
+  static std::vector<Passenger *> free_list_;  ///< released slots
+  static int next_in_chunk_;  ///< first unused slot in newest chunk
+};
+#endif  // SRC_PASSENGER_POOL_H_
@@ -0,0 +1,145 @@
+/**
+ * @file phase_profiler.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+/*******************************************************************************
+* Includes
+******************************************************************************/
+#include "src/phase_profiler.h"
+
+#include <cstdio>
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+static double SecondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(
+             std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+const char * const PhaseProfiler::kPhaseNames[kNumPhases] = {
+  "spawn", "generate", "stops", "busses", "report"
+};
+const char * const PhaseProfiler::kCounterNames[kNumCounters] = {
+  "generated", "boarded", "alighted", "spawned", "retired"
+};
+
+PhaseProfiler::PhaseTimer::PhaseTimer(PhaseProfiler * profiler, Phase phase)
+    : profiler_(profiler), phase_(phase) {
+  if (profiler_ != NULL) {
+    start_ = std::chrono::steady_clock::now();
+  }
+}
+
+PhaseProfiler::PhaseTimer::~PhaseTimer() {
+  if (profiler_ != NULL) {
+    profiler_->AddTime(phase_, SecondsSince(start_));
+  }
+}
+
+PhaseProfiler::PhaseProfiler() : csv_(NULL), tick_(0), num_ticks_(0),
+                                 total_tick_time_(0) {
+  for (int i = 0; i < kNumPhases; i++) {
+    tick_time_[i] = 0;
+    total_time_[i] = 0;
+  }
+  for (int i = 0; i < kNumCounters; i++) {
+    tick_count_[i] = 0;
+    total_count_[i] = 0;
+  }
+}
+
+void PhaseProfiler::SetCsv(std::ostream * csv) {
+  csv_ = csv;
+  if (csv_ == NULL) {
+    return;
+  }
+  *csv_ << "tick";
+  for (int i = 0; i < kNumPhases; i++) {
+    *csv_ << "," << kPhaseNames[i] << "_us";
+  }
+  *csv_ << ",total_us";
+  for (int i = 0; i < kNumCounters; i++) {
+    *csv_ << "," << kCounterNames[i];
+  }
+  *csv_ << "\n";
+}
+
+void PhaseProfiler::BeginTick(int tick) {
+  tick_ = tick;
+  for (int i = 0; i < kNumPhases; i++) {
+    tick_time_[i] = 0;
+  }
+  for (int i = 0; i < kNumCounters; i++) {
+    tick_count_[i] = 0;
+  }
+  tick_start_ = std::chrono::steady_clock::now();
+}
+
+void PhaseProfiler::EndTick() {
+  double tick_time = SecondsSince(tick_start_);
+  num_ticks_++;
+  total_tick_time_ += tick_time;
+  for (int i = 0; i < kNumPhases; i++) {
+    total_time_[i] += tick_time_[i];
+  }
+  for (int i = 0; i < kNumCounters; i++) {
+    total_count_[i] += tick_count_[i];
+  }
+
+  if (csv_ == NULL) {
+    return;
+  }
+  *csv_ << tick_;
+  for (int i = 0; i < kNumPhases; i++) {
+    *csv_ << "," << tick_time_[i] * 1e6;
+  }
+  *csv_ << "," << tick_time * 1e6;
+  for (int i = 0; i < kNumCounters; i++) {
+    *csv_ << "," << tick_count_[i];
+  }
+  *csv_ << "\n";
+}
+
+void PhaseProfiler::AddTime(Phase phase, double seconds) {
+  tick_time_[phase] += seconds;
+}
+
+void PhaseProfiler::Count(Counter counter, int64_t amount) {
+  tick_count_[counter] += amount;
+}
+
+// the share column is of the whole tick, so what no phase covers shows as
+// the difference from 100%
+void PhaseProfiler::ReportSummary(std::ostream& out) const {
+  char line[96];
+  int ticks = num_ticks_ > 0 ? num_ticks_ : 1;
+  snprintf(line, sizeof(line), "%-10s %12s %12s %8s\n", "Phase", "total s",
+           "us/tick", "share");
+  out << line;
+  for (int i = 0; i < kNumPhases; i++) {
+    snprintf(line, sizeof(line), "%-10s %12.4f %12.2f %7.1f%%\n",
+             kPhaseNames[i], total_time_[i], total_time_[i] * 1e6 / ticks,
+             total_tick_time_ > 0 ? 100 * total_time_[i] / total_tick_time_
+                                  : 0);
+    out << line;
+  }
+  snprintf(line, sizeof(line), "%-10s %12.4f %12.2f\n", "tick",
+           total_tick_time_, total_tick_time_ * 1e6 / ticks);
+  out << line;
+
+  snprintf(line, sizeof(line), "%-10s %12s %12s\n", "Counter", "total",
+           "per tick");
+  out << line;
+  for (int i = 0; i < kNumCounters; i++) {
+    snprintf(line, sizeof(line), "%-10s %12lld %12.2f\n", kCounterNames[i],
+             static_cast<long long>(total_count_[i]),
+             static_cast<double>(total_count_[i]) / ticks);
+    out << line;
+  }
+}
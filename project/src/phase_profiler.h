@@ -0,0 +1,125 @@
+/**
+ * @file phase_profiler.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_PHASE_PROFILER_H_
+#define SRC_PHASE_PROFILER_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Time spent in each phase of a simulator's Update() and what happened in it.
+ *
+ * A simulator given a profiler wraps each phase in a PhaseTimer and adds its
+ *  counts once per tick. Totals are kept for ReportSummary(), and with a CSV
+ *  stream set every tick is also written as one row. A simulator without a
+ *  profiler builds no timers and reads no clocks.
+ */
+class PhaseProfiler {
+ public:
+  // in the order ConfigurationSimulator::Update() runs them
+  enum Phase {
+    kSpawn,  ///< starting new busses
+    kGenerate,  ///< routes generating passengers
+    kStops,  ///< stops counting a step for their waiting passengers
+    kBusses,  ///< moving busses, visiting stops and removing finished ones
+    kReport,  ///< writing routes and busses out
+    kNumPhases
+  };
+  enum Counter {
+    kGenerated,  ///< passengers added at stops
+    kBoarded,  ///< passengers loaded onto busses
+    kAlighted,  ///< passengers unloaded at their destination
+    kSpawned,  ///< busses started
+    kRetired,  ///< busses that finished both routes and were removed
+    kNumCounters
+  };
+
+  /**
+  * @brief Adds the time from construction to destruction to a phase.
+  *
+  * Does nothing, not even reading the clock, when the profiler is NULL.
+  */
+  class PhaseTimer {
+   public:
+    PhaseTimer(PhaseProfiler * profiler, Phase phase);
+    ~PhaseTimer();
+
+   private:
+    PhaseProfiler * profiler_;
+    Phase phase_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  PhaseProfiler();
+
+  /**
+  * @brief Writes the CSV header to a stream and a row to it at every EndTick().
+  * @param[in] ostream * to write to, which must outlive the profiler, or NULL to stop.
+  *
+  */
+  void SetCsv(std::ostream *);
+  /**
+  * @brief Starts a tick, clearing its phase times and counts.
+  * @param[in] int holding the time step the simulator is now in.
+  *
+  */
+  void BeginTick(int);
+  /**
+  * @brief Ends a tick, adding it to the totals and writing its CSV row.
+  *
+  */
+  void EndTick();
+  /**
+  * @brief Adds time to a phase of the current tick.
+  * @param[in] Phase the time was spent in.
+  * @param[in] double holding seconds.
+  *
+  */
+  void AddTime(Phase, double);
+  /**
+  * @brief Adds to a counter of the current tick.
+  * @param[in] Counter to add to.
+  * @param[in] int64_t holding the amount.
+  *
+  */
+  void Count(Counter, int64_t);
+  /**
+  * @brief Writes total and per-tick time of each phase, then each counter's total and per-tick mean.
+  * @param[in] ostream to write to.
+  *
+  */
+  void ReportSummary(std::ostream&) const;
+
+  int GetNumTicks() const { return num_ticks_; }
+  double GetTotalTime(Phase phase) const { return total_time_[phase]; }
+  int64_t GetTotalCount(Counter counter) const {
+    return total_count_[counter];
+  }
+
+ private:
+  static const char * const kPhaseNames[kNumPhases];
+  static const char * const kCounterNames[kNumCounters];
+
+  std::ostream * csv_;  ///< receives one row per tick, NULL for none
+  int tick_;  ///< time step of the current tick
+  int num_ticks_;  ///< ticks ended so far
+  std::chrono::steady_clock::time_point tick_start_;
+  double tick_time_[kNumPhases];  ///< seconds per phase this tick
+  int64_t tick_count_[kNumCounters];  ///< counts this tick
+  double total_time_[kNumPhases];  ///< seconds per phase over all ticks
+  double total_tick_time_;  ///< seconds from BeginTick() to EndTick(), summed
+  int64_t total_count_[kNumCounters];  ///< counts over all ticks
+};
+
+#endif  // SRC_PHASE_PROFILER_H_
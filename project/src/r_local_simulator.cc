@@ -106,8 +106,14 @@ bool rLocalSimulator::Start() {
   prototype_routes_.push_back(CC_EB);
   prototype_routes_.push_back(CC_WB);
 
-  prototype_routes_[0]->Report(std::cout);
-  prototype_routes_[1]->Report(std::cout);
+  if (report_level_ == kReportFull) {
+    prototype_routes_[0]->Report(std::cout);
+    prototype_routes_[1]->Report(std::cout);
+  }
+  if (trace_) {
+    prototype_routes_[0]->Trace(trace_);
+    prototype_routes_[1]->Trace(trace_);
+  }
 
   bus_counters_.push_back(10000);
 
@@ -125,8 +131,13 @@ bool rLocalSimulator::Start() {
 bool rLocalSimulator::Update() {
   // increase time
   simulation_time_elapsed_++;
-  std::cout << "~~~~~~~~~~~~~ The time is now " << simulation_time_elapsed_;
-  std::cout << " ~~~~~~~~~~~~~" << std::endl;
+  if (report_level_ == kReportFull) {
+    std::cout << "~~~~~~~~~~~~~ The time is now " << simulation_time_elapsed_;
+    std::cout << " ~~~~~~~~~~~~~" << std::endl;
+  }
+  if (trace_) {
+    trace_->WriteTick(simulation_time_elapsed_);
+  }
 
   // various route-indexed list iterators
   std::vector<int>::iterator bus_gen_timing_iter = bus_start_timings_.begin();
@@ -167,7 +178,12 @@ bool rLocalSimulator::Update() {
     // update bus
     (*bus_iter)->Update();
     // bus report
-    (*bus_iter)->Report(std::cout);
+    if (report_level_ == kReportFull) {
+      (*bus_iter)->Report(std::cout);
+    }
+    if (trace_) {
+      (*bus_iter)->Trace(trace_);
+    }
   }
 
   // for each stop
@@ -175,7 +191,16 @@ bool rLocalSimulator::Update() {
       route_iter != prototype_routes_.end(); route_iter++) {
     // update stop
     (*route_iter)->Update();
-    (*route_iter)->Report(std::cout);
+    if (report_level_ == kReportFull) {
+      (*route_iter)->Report(std::cout);
+    }
+    if (trace_) {
+      (*route_iter)->Trace(trace_);
+    }
+  }
+
+  if (report_level_ == kReportSummary) {
+    ReportSummary(std::cout, simulation_time_elapsed_);
   }
 
   return true;
@@ -6,11 +6,121 @@
 
 #include "src/random_passenger_generator.h"
 
-std::minstd_rand0 RandomPassengerGenerator::my_rand(time(0));
+#include <algorithm>
+#include <cmath>
 
-// Nothing to do here, just pass args along
+unsigned int RandomPassengerGenerator::master_seed_ = time(0);
+unsigned int RandomPassengerGenerator::num_streams_ = 0;
+bool RandomPassengerGenerator::batch_sampling_ = false;
+
+// seed this generator's stream from the master seed and its stream number
 RandomPassengerGenerator::RandomPassengerGenerator(std::list<double> probs,
-    std::list<Stop *> stops) : PassengerGenerator(probs, stops) {}
+    std::list<Stop *> stops) : PassengerGenerator(probs, stops) {
+  std::seed_seq stream_seed{master_seed_, num_streams_};
+  my_rand_.seed(stream_seed);
+  num_streams_++;
+
+  for (std::list<double>::iterator prob_iter = probs.begin();
+       prob_iter != probs.end(); prob_iter++) {
+    arrival_cdfs_.push_back(BuildArrivalCdf(*prob_iter));
+  }
+  stops_by_position_.assign(stops.begin(), stops.end());
+}
+
+// streams already handed out are unaffected, so call before building routes
+void RandomPassengerGenerator::SetMasterSeed(unsigned int seed) {
+  master_seed_ = seed;
+  num_streams_ = 0;
+}
+
+void RandomPassengerGenerator::SetBatchSampling(bool batch_sampling) {
+  batch_sampling_ = batch_sampling;
+}
+
+/*
+ *  The trial loop in GeneratePassengers runs one independent trial with probability p, p^2, p^3, ...
+ *  until the probability drops below .0001, so the number of arrivals is the sum of those trials.
+ *  Convolving the trials one at a time gives the exact probability of each count,
+ *  which is stored as a running total so a single uniform draw picks the count.
+ */
+std::vector<double> RandomPassengerGenerator::BuildArrivalCdf(
+                                                  double initial_probability) {
+  std::vector<double> pmf(1, 1.0);
+  double current_probability = initial_probability;
+  // the trial loop never ends for p >= 1, cap it like a very busy stop
+  const int max_trials = 64;
+  while (current_probability > .0001
+         && static_cast<int>(pmf.size()) <= max_trials) {
+    double trial = std::min(current_probability, 1.0);
+    pmf.push_back(0);
+    for (int count = static_cast<int>(pmf.size()) - 1; count > 0; count--) {
+      pmf[count] = pmf[count] * (1 - trial) + pmf[count - 1] * trial;
+    }
+    pmf[0] *= (1 - trial);
+    current_probability *= initial_probability;
+  }
+
+  std::vector<double> cdf(pmf.size());
+  double total = 0;
+  for (int count = 0; count < static_cast<int>(pmf.size()); count++) {
+    total += pmf[count];
+    cdf[count] = total;
+  }
+  return cdf;
+}
+
+int RandomPassengerGenerator::SampleArrivals(const std::vector<double>& cdf,
+                                             double generation_value) {
+  // tables are short and small counts are most likely, so scan from zero
+  int last = static_cast<int>(cdf.size()) - 1;
+  for (int count = 0; count < last; count++) {
+    if (generation_value < cdf[count]) {
+      return count;
+    }
+  }
+  // rounding can leave the total just under 1
+  return last;
+}
+
+/*
+ *  Each step has arrivals with the same chance, 1 - cdf[0], independently of the others,
+ *  so the number of steps until the next one with arrivals is geometric and one draw picks it.
+ */
+int RandomPassengerGenerator::StepsToNextArrival(int stop_index) {
+  double none = arrival_cdfs_[stop_index][0];
+  if (none >= 1) {
+    return 0;
+  }
+  if (none <= 0) {
+    return 1;
+  }
+  double steps = 1 + std::floor(std::log(1 - NextUniform()) / std::log(none));
+  // a draw of exactly 1 gives an infinite wait
+  return steps < kMaxStepsToArrival ? static_cast<int>(steps)
+                                    : kMaxStepsToArrival;
+}
+
+int RandomPassengerGenerator::GenerateArrivalsAt(int stop_index) {
+  const std::vector<double>& cdf = arrival_cdfs_[stop_index];
+  // the step is known to have arrivals, so draw above the chance of none
+  int arrivals = SampleArrivals(cdf, cdf[0] + NextUniform() * (1 - cdf[0]));
+  return AddArrivals(stops_by_position_[stop_index], stop_index, arrivals);
+}
+
+int RandomPassengerGenerator::AddArrivals(Stop * stop, int stop_index,
+                                          int arrivals) {
+  int passengers_added = 0;
+  for (int i = 0; i < arrivals; i++) {
+    Passenger * tmp = PassengerFactory::
+                      Generate(stop_ids_, stop_index, &my_rand_);
+    passengers_added += stop->AddPassengers(tmp, GetStopQueue(stop_index));
+  }
+  return passengers_added;
+}
+
+double RandomPassengerGenerator::NextUniform() {
+  return ((my_rand_() - my_rand_.min()) / (my_rand_.max() * 1.0));
+}
 
 /*
  *  GeneratePassengers uses the route's passenger generation probabilities per stop to determine how many passengers to create.
@@ -24,13 +134,26 @@ int RandomPassengerGenerator::GeneratePassengers() {
   int passengers_added = 0;
   std::list<double>::iterator prob_iter;
   std::list<Stop *>::iterator stop_iter;
-  stop_iter = stops_.begin();
-  int stop_index = (*stop_iter)->GetId();  // used for passenger generation
-  stop_iter = stops_.end();
-  stop_iter--;
-  int last_stop_index = (*stop_iter)->GetId();
+  // position along the route, shared stops make ids non-consecutive
+  int stop_index = 0;
   // TODO(Staff): check for accuracy
-  std::cout << "Time to generate!" << std::endl;
+  // single write so generators on other threads never split the line
+  if (report_level_ == kReportFull) {
+    std::cout << "Time to generate!\n";
+  }
+  if (batch_sampling_) {
+    std::vector<std::vector<double>>::const_iterator cdf_iter;
+    for (cdf_iter = arrival_cdfs_.begin(), stop_iter = stops_.begin();
+         cdf_iter != arrival_cdfs_.end() && stop_iter != stops_.end();
+         cdf_iter++, stop_iter++) {
+      // one draw decides how many passengers arrive, then create them all
+      int arrivals = SampleArrivals(*cdf_iter, NextUniform());
+      passengers_added += AddArrivals(*stop_iter, stop_index, arrivals);
+      stop_index++;
+    }
+    return passengers_added;
+  }
+
   for (prob_iter = generation_probabilities_.begin(),
                           stop_iter = stops_.begin();
        prob_iter != generation_probabilities_.end()
@@ -43,8 +166,7 @@ int RandomPassengerGenerator::GeneratePassengers() {
     // while there is still a (>.01%) chance of generating a passenger, try
     while (current_generation_probability > .0001) {
       // generate a random double value_comp
-      double generation_value =
-               ((my_rand() - my_rand.min()) / (my_rand.max() * 1.0));
+      double generation_value = NextUniform();
       // e.g. `.54234234 < .90`, generate a passenger
       // `.912353254 !< .90`, don't generate
       // this gives us a 90% chance of creating a passenger
@@ -52,9 +174,9 @@ int RandomPassengerGenerator::GeneratePassengers() {
         // use the passenger factory to determine the destination
         // return value is 1 if passenger was added, 0 if it wasn't
         Passenger * tmp = PassengerFactory::
-                          Generate(stop_index,
-                                 last_stop_index);
-        passengers_added += (*stop_iter)->AddPassengers(tmp);
+                          Generate(stop_ids_, stop_index, &my_rand_);
+        passengers_added += (*stop_iter)->AddPassengers(tmp,
+                                                   GetStopQueue(stop_index));
       }
       // whether you generated or not, square the probability (reducing it)
       current_generation_probability *= initial_generation_probability;
@@ -7,9 +7,11 @@
 #ifndef SRC_RANDOM_PASSENGER_GENERATOR_H_
 #define SRC_RANDOM_PASSENGER_GENERATOR_H_
 
+#include <climits>
 #include <list>
 #include <random>
 #include <ctime>
+#include <vector>
 
 #include "src/passenger_generator.h"
 #include "src/stop.h"
@@ -20,9 +22,41 @@ class RandomPassengerGenerator : public PassengerGenerator{
  public:
   RandomPassengerGenerator(std::list<double>, std::list<Stop *>);
   int GeneratePassengers() override;
+  // every generator draws from its own stream, split from the master seed
+  // in construction order, so routes can generate on separate threads and
+  // a run is still reproducible for a given seed
+  static void SetMasterSeed(unsigned int);
+  // when on, the number of arrivals at each stop is drawn once from a table
+  // built at construction instead of running one trial per squared probability
+  static void SetBatchSampling(bool);
+  // exact distribution of the trial loop's count for one stop's probability,
+  // as a cumulative table indexed by number of arrivals
+  static std::vector<double> BuildArrivalCdf(double);
+  // for simulators that schedule each stop on its own: steps from now to the
+  // next step with arrivals at the stop in the given position, drawn so the
+  // steps in between are empty exactly as often as GeneratePassengers leaves
+  // them empty, or 0 if the stop never gets anyone
+  int StepsToNextArrival(int);
+  // adds the passengers arriving at the stop in the given position in a step
+  // picked by StepsToNextArrival, so at least one, returns how many
+  int GenerateArrivalsAt(int);
 
  private:
-  static std:: minstd_rand0 my_rand;
+  // the table's value at a draw in [0, 1], returns number of arrivals
+  int SampleArrivals(const std::vector<double>&, double);
+  // creates passengers at the stop in the given position, returns how many
+  int AddArrivals(Stop *, int, int);
+  // one uniform draw in [0, 1) from my_rand_
+  double NextUniform();
+
+  std::mt19937 my_rand_;
+  std::vector<std::vector<double>> arrival_cdfs_;  // one per stop
+  std::vector<Stop *> stops_by_position_;  // stops_, for one stop at a time
+  // farther than any simulation runs, and still safe to add a time step to
+  static const int kMaxStepsToArrival = INT_MAX / 2;
+  static bool batch_sampling_;
+  static unsigned int master_seed_;
+  static unsigned int num_streams_;
 };
 
 #endif  // SRC_RANDOM_PASSENGER_GENERATOR_H_
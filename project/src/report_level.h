@@ -0,0 +1,23 @@
+/**
+ * @file report_level.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_REPORT_LEVEL_H_
+#define SRC_REPORT_LEVEL_H_
+
+/**
+ * @brief How much a simulator writes to std::cout while it runs.
+ *
+ * kReportNone does no stream output at all inside Update(), for batch studies.
+ *  kReportSummary writes one line per time step.
+ *  kReportFull calls Report() on every route and bus, which is the default.
+ */
+enum ReportLevel {
+  kReportNone = 0,
+  kReportSummary = 1,
+  kReportFull = 2
+};
+
+#endif  // SRC_REPORT_LEVEL_H_
@@ -12,18 +12,12 @@
 #include <algorithm>
 #include <vector>
 
-Route::Route(std::string name, Stop ** stops, double * distances, int num_stops,
-             PassengerGenerator * pass_gen) {
-  for (int i = 0; i < num_stops; i++) {
-    stops_.push_back(stops[i]);
-  }
-  for (int i = 0; i < num_stops - 1; i++) {
-    distances_between_.push_back(distances[i]);
-  }
+#include "src/trace_writer.h"
 
-  name_ = name;
-  num_stops_ = num_stops;
-  generator_ = pass_gen;
+Route::Route(std::string name, Stop ** stops, double * distances, int num_stops,
+             PassengerGenerator * pass_gen) :
+             topology_(std::make_shared<RouteTopology>(name, stops, distances,
+                                                       num_stops, pass_gen)) {
   // initialize destination for when bus calls Move()
   destination_stop_ = stops[0];
   destination_stop_index_ = 0;
@@ -31,48 +25,66 @@ Route::Route(std::string name, Stop ** stops, double * distances, int num_stops,
 
 void Route::Update() {
   // Geenerate passengers and update each Stop in the Route
-  generator_->GeneratePassengers();
-  for (std::list<Stop *>::iterator it = stops_.begin();
-       it != stops_.end(); it++) {
-    (*it)->Update();
+  GenerateNewPassengers();
+  UpdateStops();
+}
+
+// generates passengers on its route
+int Route::GenerateNewPassengers() {
+  return topology_->GetGenerator()->GeneratePassengers();
+}
+
+void Route::UpdateStops() {
+  const std::vector<Stop *>& stops = topology_->GetStops();
+  // only this route's queue, shared stops are updated once by each route
+  const std::vector<int>& visits = topology_->GetFirstVisits();
+  for (int i = 0; i < static_cast<int>(visits.size()); i++) {
+    stops[visits[i]]->Update(topology_->GetStopQueue(visits[i]));
   }
   UpdateRouteData();
 }
 
 void Route::Report(std::ostream& os) {
-  os << "Name: " << name_ << std::endl;
-  os << "Num stops: " << num_stops_ << std::endl;
+  const std::vector<Stop *>& stops = topology_->GetStops();
+  os << "Name: " << topology_->GetName() << "\n";
+  os << "Num stops: " << stops.size() << "\n";
   int stop_counter = 0;
-  for (std::list<Stop *>::const_iterator it = stops_.begin();
-      it != stops_.end(); it++) {
+  for (std::vector<Stop *>::const_iterator it = stops.begin();
+      it != stops.end(); it++) {
     (*it)->Report(os);
     stop_counter++;
   }
 }
 
+void Route::Trace(TraceWriter * trace) {
+  const std::vector<Stop *>& stops = topology_->GetStops();
+  trace->WriteRoute(topology_->GetName(), stops.size());
+  for (std::vector<Stop *>::const_iterator it = stops.begin();
+      it != stops.end(); it++) {
+    (*it)->Trace(trace);
+  }
+}
+
 // return clone to be used with prototype routes
+// copying only duplicates the destination, topology_ is shared
 Route * Route::Clone() {
   return new Route(*this);
 }
 
 // end of route signifed by reaching the last stop in list
 bool Route::IsAtEnd() const {
-  if (destination_stop_index_ < num_stops_ - 1) {
+  if (destination_stop_index_ < topology_->GetNumStops() - 1) {
     return false;
   }
   return true;
 }
 
-// iterates through stops_ with current destination stop to find next stop
+// stops are indexed directly, so advancing is constant time
 void Route::NextStop() {
   if (!IsAtEnd()) {
     // increment destination to we look for next stop in list
     ++destination_stop_index_;
-    std::list<Stop*>::const_iterator current_stop_ = stops_.begin();
-    for (int i = 0; i < destination_stop_index_; ++i) {
-      ++current_stop_;
-    }
-    destination_stop_ = *current_stop_;
+    destination_stop_ = topology_->GetStop(destination_stop_index_);
   }
 }
 
@@ -81,63 +93,61 @@ Stop * Route::GetDestinationStop() const {
   return destination_stop_;
 }
 
+// passengers at a shared stop only board buses of the route they wait for
+int Route::GetDestinationQueue() const {
+  return topology_->GetStopQueue(destination_stop_index_);
+}
+
+// total distance from first stop to current destination stop
+double Route::GetTotalRouteDistance() const {
+  return topology_->GetCumulativeDistance(destination_stop_index_);
+}
+
 // previous stop used to create BusData struct
 Stop * Route::GetPreviousStop() {
-std::list<Stop*>::const_iterator current_stop_ = stops_.begin();
-  for (int i = 0; i < destination_stop_index_-1; ++i) {
-    ++current_stop_;
+  if (destination_stop_index_ > 0) {
+    return topology_->GetStop(destination_stop_index_ - 1);
   }
-  return *current_stop_;
+  return topology_->GetStop(0);
 }
 
-// iterate through distances to find distance for next stop
-// to be used after NextStop()
+// distance for next stop, to be used after NextStop()
 double Route::GetNextStopDistance() const {
-  std::list<double>::const_iterator
-                  current_distance_ = distances_between_.begin();
-  for (int i = 0; i < destination_stop_index_; ++i) {
-    ++current_distance_;
-  }
-  return *current_distance_;
+  return topology_->GetDistance(destination_stop_index_);
 }
 
 // called by the visualizer to get the name of the route
 std::string Route::GetName() {
-  return name_;
+  return topology_->GetName();
 }
 
 // called by the visualizer to get the route's list of Stop pointers
-std::list<Stop *> Route::GetStops() {
-  return stops_;
+const std::vector<Stop *>& Route::GetStops() const {
+  return topology_->GetStops();
 }
 
 // update route_data_ struct with most recent information in Update
-void Route::UpdateRouteData() {
-  // store a unique identifier for the route
-  route_data_.id = GetName();
-  // create a vector that holds StopData structs.
-  std::vector<StopData> temp_stops;
-  double lon, lat;
-
-  // loop through the Route's stops
-  for (std::list<Stop *>::const_iterator it = stops_.begin();
-      it != stops_.end(); it++) {
-    // temmpory stop struct to be stored in vector
-    StopData temp;
-    temp.id = std::to_string((*it)->GetId());
-    temp.num_people = (*it)->GetNumPassengers();
-
-    std::tie(lon, lat) = (*it)->GetCoordinates();
-    temp.position.x = lon;
-    temp.position.y = lat;
-
-    temp_stops.push_back(temp);
+// route_data_ lives in the topology, so clones see the same struct,
+// and its ids and positions were filled in when the topology was built
+bool Route::UpdateRouteData() {
+  std::vector<StopData>& stop_data = topology_->GetRouteData()->stops;
+  const std::vector<Stop *>& stops = topology_->GetStops();
+  bool changed = false;
+  for (int i = 0; i < static_cast<int>(stops.size()); i++) {
+    int num_people = stops[i]->GetNumPassengers();
+    if (stop_data[i].num_people != num_people) {
+      stop_data[i].num_people = num_people;
+      changed = true;
+    }
   }
-  // store the vector of StopData structs
-  route_data_.stops = temp_stops;
+  return changed;
 }
 
 // called by the visualizer to obtain the RouteData struct
-RouteData Route::GetRouteData() {
-  return route_data_;
+const RouteData& Route::GetRouteData() const {
+  return *topology_->GetRouteData();
+}
+
+const SegmentGeometry& Route::GetSegment() const {
+  return topology_->GetSegment(destination_stop_index_);
 }
@@ -11,16 +11,19 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
-#include <list>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "src/passenger_generator.h"
 #include "src/stop.h"
 #include "src/data_structs.h"
+#include "src/route_topology.h"
 
 class PassengerGenerator;
 class Stop;
+class TraceWriter;
 
 /*******************************************************************************
  * Class Definitions
@@ -29,7 +32,8 @@ class Stop;
  * @brief The main class for the aggregation of Stop objects.
  *
  * Holds information about list of stops to be used by buses. 
- * 
+ *  The stops and distances live in a RouteTopology shared with every clone,
+ *  so a Route itself only tracks which stop is the current destination.
  */
 class Route {
  public:
@@ -48,7 +52,7 @@ class Route {
         PassengerGenerator *);
   /**
   * @brief Creates a clone of the current route.
-  * @return Route * with all same attributes of prototype route.
+  * @return Route * sharing the prototype's RouteTopology, with its own destination.
   *
   */
   Route * Clone();
@@ -58,12 +62,32 @@ class Route {
   */
   void Update();
   /**
+  * @brief Generates passengers on its route using its PassengerGenerator.
+  *
+  * Only touches this route's generator and stops, so simulators may call it
+  *  for several routes at once before finishing each with \ref UpdateStops.
+  * @return int number of passengers generated.
+  *
+  */
+  int GenerateNewPassengers();
+  /**
+  * @brief The part of Update() after generation: calls Update() on each stop and refreshes RouteData.
+  *
+  */
+  void UpdateStops();
+  /**
   * @brief Outputs name_, num_stops_, and calls Report() on each stop in route.
   * @param[in] ostream used to output information.
   *
   */
   void Report(std::ostream&);
   /**
+  * @brief Records what Report() prints to a binary trace.
+  * @param[in] TraceWriter * receiving the records.
+  *
+  */
+  void Trace(TraceWriter *);
+  /**
   * @brief Returns true if all stops in route have been visited, false otherwise.
   * @return bool indicating that there are no more stops in route to be visited.
   *
@@ -81,6 +105,12 @@ class Route {
   */
   Stop * GetDestinationStop() const;    // Get pointer to next stop
   /**
+  * @brief Returns this route's queue at the destination stop, used when boarding.
+  * @return int queue to pass to Stop::LoadPassengers().
+  *
+  */
+  int GetDestinationQueue() const;
+  /**
   * @brief Returns total distance between first stop and destination stop in route.
   * @return double of distance between beginning of route and current destination.
   *
@@ -88,7 +118,8 @@ class Route {
   double GetTotalRouteDistance() const;
   /**
   * @brief Returns distance to next stop in route.
-  * @return double of distance between previous stop and current destination.
+  * @return double of distance between previous stop and current destination,
+  *   or 0 once the last stop of the route is the destination.
   *
   */
   double GetNextStopDistance() const;
@@ -106,38 +137,44 @@ class Route {
   std::string GetName();
   /**
   * @brief Called by the visualizer to get the route's list of Stop pointers.
-  * @return list<Stop *>> representing list of stops of route.
+  * @return vector<Stop *> representing stops of route in visiting order.
   * 
   */
-  std::list<Stop *> GetStops();
+  const std::vector<Stop *>& GetStops() const;
+  /**
+  * @brief Finds where a bus on this route next stops at a stop, see RouteTopology::FindVisit().
+  * @param[in] int holding id of the stop.
+  * @param[in] int holding index to search from.
+  * @return int index of the first visit at or after it, or -1 if there is none.
+  */
+  int FindVisit(int stop_id, int from) const {
+    return topology_->FindVisit(stop_id, from);
+  }
   /**
   * @brief Called by visualizer to instruct route to populate the RouteData struct with latest information.
+  *
+  * Only the number of people at each stop can change, so nothing is rebuilt.
+  * @return bool indicating if any count changed since the last call.
   * 
   */
-  void UpdateRouteData();
+  bool UpdateRouteData();
   /**
   * @brief Called by the visualizer to obtain the RouteData struct.
-  * @return RouteData struct with most recent information of route.
+  * @return RouteData struct with most recent information of route, shared by all clones.
   * 
   */
-  RouteData GetRouteData();
-
- private:
+  const RouteData& GetRouteData() const;
   /**
-  * @brief Generates passengers on its route using generator_.
-  * @return 1 indicating passenger has been successfully generated.
+  * @brief Returns the geometry of the leg leading to the destination stop.
+  * @return SegmentGeometry shared by all clones of the route.
   *
   */
-  int GenerateNewPassengers();       // generates passengers on its route
-  PassengerGenerator * generator_;  ///< used to generate passengers at stops
-  std::list<Stop *> stops_;  ///< list of stops that comprise route
-  std::list<double> distances_between_;  // length = num_stops_ - 1
-  std::string name_;  ///< route identification
-  int num_stops_;  ///< number of stops route has
+  const SegmentGeometry& GetSegment() const;
+
+ private:
+  std::shared_ptr<RouteTopology> topology_;  ///< shared with all clones
   int destination_stop_index_;  // always starts at zero, no init needed
   Stop * destination_stop_;  ///< current destination of bus
-  double trip_time_;  // derived data - total distance travelled on route
-  RouteData route_data_;  ///< struct used for visualizer
 };
 #endif  // SRC_ROUTE_H_
 
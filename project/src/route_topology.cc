@@ -0,0 +1,144 @@
+/**
+ * @file route_topology.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+/*******************************************************************************
+* Includes
+******************************************************************************/
+#include "src/route_topology.h"
+
+#include <string>
+#include <tuple>
+#include <unordered_set>
+
+#include "src/passenger_generator.h"
+#include "src/stop.h"
+
+RouteTopology::RouteTopology(std::string name, Stop ** stops,
+                             double * distances, int num_stops,
+                             PassengerGenerator * pass_gen) :
+                             name_(name), stops_(stops, stops + num_stops),
+                             generator_(pass_gen) {
+  // stops can be shared with other routes, so claim a queue at each one
+  std::unordered_set<Stop *> visited;
+  for (int i = 0; i < num_stops; i++) {
+    stop_queues_.push_back(stops_[i]->AddRoute(name_));
+    if (visited.insert(stops_[i]).second) {
+      first_visits_.push_back(i);
+    }
+  }
+  // each stop's visits are chained, walked back to front so every index
+  // points at the one after it
+  std::unordered_map<int, int> later_visit;
+  next_same_stop_.resize(num_stops, -1);
+  for (int i = num_stops - 1; i >= 0; i--) {
+    int id = stops_[i]->GetId();
+    std::unordered_map<int, int>::iterator later = later_visit.find(id);
+    if (later != later_visit.end()) {
+      next_same_stop_[i] = later->second;
+    }
+    later_visit[id] = i;
+  }
+  visit_by_id_.swap(later_visit);
+  if (generator_) {
+    generator_->SetStopQueues(stop_queues_);
+  }
+  if (num_stops > 1) {
+    distances_between_.assign(distances, distances + num_stops - 1);
+  }
+  // prefix sum so distance from the first stop is a single lookup
+  cumulative_distances_.resize(num_stops, 0);
+  for (int i = 1; i < num_stops; i++) {
+    cumulative_distances_[i] = cumulative_distances_[i - 1]
+                               + distances_between_[i - 1];
+  }
+
+  // ids and positions never change, so the visualizer struct is built
+  // once here and Route::UpdateRouteData() only refreshes the counts
+  route_data_.id = name_;
+  route_data_.stops.resize(num_stops);
+  double lon, lat;
+  for (int i = 0; i < num_stops; i++) {
+    StopData& stop_data = route_data_.stops[i];
+    stop_data.id = std::to_string(stops_[i]->GetId());
+    std::tie(lon, lat) = stops_[i]->GetCoordinates();
+    stop_data.position.x = lon;
+    stop_data.position.y = lat;
+    stop_data.num_people = stops_[i]->GetNumPassengers();
+  }
+
+  // leg i runs from the stop before i to stop i
+  segments_.resize(num_stops);
+  for (int i = 0; i < num_stops; i++) {
+    segments_[i].start = route_data_.stops[i > 0 ? i - 1 : 0].position;
+    segments_[i].end = route_data_.stops[i].position;
+    segments_[i].length = GetDistance(i);
+  }
+}
+
+const std::string& RouteTopology::GetName() const {
+  return name_;
+}
+
+int RouteTopology::GetNumStops() const {
+  return static_cast<int>(stops_.size());
+}
+
+Stop * RouteTopology::GetStop(int index) const {
+  return stops_[index];
+}
+
+int RouteTopology::GetStopQueue(int index) const {
+  return stop_queues_[index];
+}
+
+const std::vector<int>& RouteTopology::GetFirstVisits() const {
+  return first_visits_;
+}
+
+int RouteTopology::FindVisit(int stop_id, int from) const {
+  std::unordered_map<int, int>::const_iterator first =
+      visit_by_id_.find(stop_id);
+  if (first == visit_by_id_.end()) {
+    return -1;
+  }
+  int index = first->second;
+  while (index != -1 && index < from) {
+    index = next_same_stop_[index];
+  }
+  // the last stop is never stopped at as part of this route
+  if (index == -1 || index >= GetNumStops() - 1) {
+    return -1;
+  }
+  return index;
+}
+
+const std::vector<Stop *>& RouteTopology::GetStops() const {
+  return stops_;
+}
+
+// there is no segment past the last stop, so report zero there
+double RouteTopology::GetDistance(int index) const {
+  if (index < static_cast<int>(distances_between_.size())) {
+    return distances_between_[index];
+  }
+  return 0;
+}
+
+double RouteTopology::GetCumulativeDistance(int index) const {
+  return cumulative_distances_[index];
+}
+
+PassengerGenerator * RouteTopology::GetGenerator() const {
+  return generator_;
+}
+
+RouteData * RouteTopology::GetRouteData() {
+  return &route_data_;
+}
+
+const SegmentGeometry& RouteTopology::GetSegment(int index) const {
+  return segments_[index];
+}
@@ -0,0 +1,152 @@
+/**
+ * @file route_topology.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_ROUTE_TOPOLOGY_H_
+#define SRC_ROUTE_TOPOLOGY_H_
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "src/data_structs.h"
+
+class PassengerGenerator;
+class Stop;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief The fixed layout of a route, shared by a prototype Route and all of its clones.
+ *
+ * Holds the name, stops, distances and passenger generator of a route.
+ *  None of these change after construction, so every Route cloned from the
+ *  same prototype references one RouteTopology instead of copying it.
+ *  The RouteData struct is kept here too since it only describes the shared stops.
+ */
+class RouteTopology {
+ public:
+  /**
+  * @brief Constructs a topology with a name, arrays of stops and distances, and a PassengerGenerator.
+  *
+  * @param[in] string holding name of route.
+  * @param[in] Stop ** holding list of stops in route.
+  * @param[in] double * holding list of distances between adjacent stops.
+  * @param[in] int holding number of stops in route.
+  * @param[in] PassengerGenerator * holding PassengerGenerator object to create passengers in simulator.
+  *
+  */
+  RouteTopology(std::string name, Stop ** stops, double * distances,
+                int num_stops, PassengerGenerator *);
+  /**
+  * @brief Returns name of route.
+  * @return string of name of route.
+  *
+  */
+  const std::string& GetName() const;
+  /**
+  * @brief Returns number of stops in route.
+  * @return int representing number of stops.
+  *
+  */
+  int GetNumStops() const;
+  /**
+  * @brief Returns stop at given index of route.
+  * @param[in] int index of stop, 0 being the first stop.
+  * @return Stop * at that index.
+  *
+  */
+  Stop * GetStop(int) const;
+  /**
+  * @brief Returns the queue this route was given at the stop at given index.
+  * @param[in] int index of stop, 0 being the first stop.
+  * @return int queue to pass to Stop::LoadPassengers() and Stop::Update().
+  *
+  */
+  int GetStopQueue(int) const;
+  /**
+  * @brief Returns index of each stop's first visit, so a stop the route passes twice is updated once.
+  * @return vector<int> of indices in visiting order.
+  *
+  */
+  const std::vector<int>& GetFirstVisits() const;
+  /**
+  * @brief Finds where a bus on this route next stops at a stop, for riders bound there.
+  *
+  * Busses stop at every stop but the last, which is reached as the first stop
+  *  of the route that follows. A stop id is one hash lookup, then one step
+  *  per earlier visit of the same stop for routes that pass it twice.
+  *
+  * @param[in] int holding id of the stop.
+  * @param[in] int holding index to search from.
+  * @return int index of the first visit at or after it, or -1 if there is none.
+  */
+  int FindVisit(int stop_id, int from) const;
+  /**
+  * @brief Returns all stops of route in visiting order.
+  * @return vector<Stop *> of stops.
+  *
+  */
+  const std::vector<Stop *>& GetStops() const;
+  /**
+  * @brief Returns distance from the stop at given index to the stop after it.
+  * @param[in] int index of stop, 0 being the first stop.
+  * @return double of segment length, or 0 for the last stop.
+  *
+  */
+  double GetDistance(int) const;
+  /**
+  * @brief Returns distance from first stop to the stop at given index.
+  * @param[in] int index of stop, 0 being the first stop.
+  * @return double of distance travelled along route up to that stop.
+  *
+  */
+  double GetCumulativeDistance(int) const;
+  /**
+  * @brief Returns the generator used to create passengers at the stops.
+  * @return PassengerGenerator * of route.
+  *
+  */
+  PassengerGenerator * GetGenerator() const;
+  /**
+  * @brief Returns the RouteData struct shared by every route with this topology.
+  *
+  * Ids and positions are filled in by the constructor, only counts change later.
+  *
+  * @return RouteData * to be refreshed by Route::UpdateRouteData().
+  *
+  */
+  RouteData * GetRouteData();
+  /**
+  * @brief Returns the geometry of the leg that ends at a stop.
+  *
+  * Its length is GetDistance() of that stop, the distance a Bus heading
+  *  there is given by Route::GetNextStopDistance().
+  *
+  * @param[in] int holding index of the stop the leg leads to.
+  * @return SegmentGeometry of the leg, the first stop's leg starts where it ends.
+  */
+  const SegmentGeometry& GetSegment(int) const;
+
+ private:
+  std::string name_;  ///< route identification
+  std::vector<Stop *> stops_;  ///< stops that comprise route, by index
+  std::vector<int> stop_queues_;  ///< this route's queue at each stop
+  std::vector<int> first_visits_;  ///< indices of stops not seen earlier
+  std::unordered_map<int, int> visit_by_id_;  ///< stop id to its first index
+  std::vector<int> next_same_stop_;  ///< next index of the same stop, or -1
+  std::vector<double> distances_between_;  // length = num_stops_ - 1
+  // cumulative_distances_[i] = distance from first stop to stop i
+  std::vector<double> cumulative_distances_;
+  PassengerGenerator * generator_;  ///< used to generate passengers at stops
+  RouteData route_data_;  ///< struct used for visualizer
+  std::vector<SegmentGeometry> segments_;  ///< leg ending at each stop
+};
+#endif  // SRC_ROUTE_TOPOLOGY_H_
@@ -28,7 +28,9 @@ int RtestPassengerGenerator::GeneratePassengers() {
   stop_iter--;
   int last_stop_index = (*stop_iter)->GetId();  // get the last stop index
 
-  std::cout << "Time to generate!" << std::endl;
+  if (report_level_ == kReportFull) {
+    std::cout << "Time to generate!" << std::endl;
+  }
 
   int count = 0;
   for (stop_iter = stops_.begin(); (*stop_iter)->GetId() < last_stop_index;
@@ -37,7 +39,7 @@ int RtestPassengerGenerator::GeneratePassengers() {
 
   Passenger * tmp = DeterministicPassengerFactory::
                         Generate(stop_index, last_stop_index);
-    passengers_added += (*stop_iter)->AddPassengers(tmp);
+    passengers_added += (*stop_iter)->AddPassengers(tmp, GetStopQueue(count));
     count++;
   }
 
@@ -0,0 +1,84 @@
+/**
+ * @file service_kpis.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+/*******************************************************************************
+* Includes
+******************************************************************************/
+#include "src/service_kpis.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "src/stop.h"
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+static void WriteMeasure(std::ostream& out, const char * name,
+                         const KpiHistogram& histogram) {
+  char line[128];
+  snprintf(line, sizeof(line),
+           "%-12s %10lld %9.2f %6lld %6lld %6lld %6lld %6lld\n", name,
+           static_cast<long long>(histogram.GetCount()), histogram.GetMean(),
+           static_cast<long long>(histogram.GetPercentile(50)),
+           static_cast<long long>(histogram.GetPercentile(90)),
+           static_cast<long long>(histogram.GetPercentile(95)),
+           static_cast<long long>(histogram.GetPercentile(99)),
+           static_cast<long long>(histogram.GetMax()));
+  out << line;
+}
+
+static bool MoreDenied(const Stop * a, const Stop * b) {
+  if (a->GetNumDenied() != b->GetNumDenied()) {
+    return a->GetNumDenied() > b->GetNumDenied();
+  }
+  return a->GetId() < b->GetId();
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void ServiceKpis::RecordBus(double load_factor) {
+  bus_load_.Record(static_cast<int64_t>(load_factor * 100 + .5));
+}
+
+void ServiceKpis::Merge(const ServiceKpis& other) {
+  wait_.Merge(other.wait_);
+  ride_.Merge(other.ride_);
+  bus_load_.Merge(other.bus_load_);
+}
+
+int64_t ServiceKpis::GetNumDenied(const std::vector<Stop *>& stops) {
+  int64_t denied = 0;
+  for (int i = 0; i < static_cast<int>(stops.size()); i++) {
+    denied += stops[i]->GetNumDenied();
+  }
+  return denied;
+}
+
+void ServiceKpis::ReportSummary(std::ostream& out,
+                                const std::vector<Stop *>& stops) const {
+  char line[128];
+  snprintf(line, sizeof(line), "%-12s %10s %9s %6s %6s %6s %6s %6s\n",
+           "Measure", "count", "mean", "p50", "p90", "p95", "p99", "max");
+  out << line;
+  WriteMeasure(out, "wait", wait_);
+  WriteMeasure(out, "ride", ride_);
+  WriteMeasure(out, "bus load %", bus_load_);
+
+  out << "Denied boardings: " << GetNumDenied(stops) << "\n";
+  std::vector<Stop *> worst(stops);
+  int listed = static_cast<int>(worst.size());
+  if (listed > kWorstStops) {
+    listed = kWorstStops;
+  }
+  std::partial_sort(worst.begin(), worst.begin() + listed, worst.end(),
+                    MoreDenied);
+  for (int i = 0; i < listed && worst[i]->GetNumDenied() > 0; i++) {
+    out << "  Stop " << worst[i]->GetId() << ": "
+        << worst[i]->GetNumDenied() << "\n";
+  }
+}
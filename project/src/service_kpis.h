@@ -0,0 +1,88 @@
+/**
+ * @file service_kpis.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_SERVICE_KPIS_H_
+#define SRC_SERVICE_KPIS_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "src/kpi_histogram.h"
+
+class Stop;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Service quality of a whole run, kept as it happens instead of per passenger.
+ *
+ * Busses record each passenger's wait at the stop when they board and their
+ *  ride when they alight, just before the passenger is released. A bus records
+ *  its mean load factor when it finishes. Every record goes into a fixed-size
+ *  KpiHistogram, so memory stays the same for a million passengers as for ten.
+ *  Passengers left behind by a full bus are counted by their Stop.
+ */
+class ServiceKpis {
+ public:
+  /**
+  * @brief Records a boarding passenger's time at the stop.
+  * @param[in] int holding time steps waited.
+  *
+  */
+  void RecordBoarding(int wait) { wait_.Record(wait); }
+  /**
+  * @brief Records an alighting passenger's time on the bus.
+  * @param[in] int holding time steps ridden.
+  *
+  */
+  void RecordAlighting(int ride) { ride_.Record(ride); }
+  /**
+  * @brief Records the mean load factor of a finished bus.
+  * @param[in] double holding riders over capacity, averaged over the stops it left.
+  *
+  */
+  void RecordBus(double);
+  /**
+  * @brief Adds every record of another run, as if recorded here.
+  * @param[in] ServiceKpis to add.
+  *
+  */
+  void Merge(const ServiceKpis&);
+  /**
+  * @brief Writes count, mean and percentiles of each measure, then denied boardings.
+  * @param[in] ostream to write to.
+  * @param[in] vector<Stop *> whose denied boardings are totalled, busiest listed.
+  *
+  */
+  void ReportSummary(std::ostream&, const std::vector<Stop *>&) const;
+
+  const KpiHistogram& GetWaitAtStop() const { return wait_; }
+  const KpiHistogram& GetRideTime() const { return ride_; }
+  // percent of capacity, one sample per finished bus
+  const KpiHistogram& GetBusLoad() const { return bus_load_; }
+  /**
+  * @brief Totals boardings denied at the stops.
+  * @param[in] vector<Stop *> to total.
+  * @return int64_t of passengers left waiting by full busses, once per bus.
+  *
+  */
+  static int64_t GetNumDenied(const std::vector<Stop *>&);
+
+ private:
+  KpiHistogram wait_;  ///< time steps at the stop, per boarding
+  KpiHistogram ride_;  ///< time steps on the bus, per alighting
+  KpiHistogram bus_load_;  ///< mean load factor in percent, per bus
+
+  /// stops with the most denied boardings listed by ReportSummary()
+  static const int kWorstStops = 5;
+};
+
+#endif  // SRC_SERVICE_KPIS_H_
@@ -0,0 +1,46 @@
+/**
+ * @file simulator.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+/*******************************************************************************
+* Includes
+******************************************************************************/
+#include "src/simulator.h"
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void Simulator::SetReportLevel(ReportLevel level) {
+  report_level_ = level;
+  PassengerGenerator::SetReportLevel(level);
+}
+
+void Simulator::SetTrace(TraceWriter * trace) {
+  trace_ = trace;
+}
+
+void Simulator::SetWebInterface(WebInterface * web_interface) {
+  web_interface_ = web_interface;
+}
+
+void Simulator::ReportSummary(std::ostream& out, int time) {
+  int num_waiting = 0;
+  for (std::vector<Route *>::iterator route_iter = prototype_routes_.begin();
+      route_iter != prototype_routes_.end(); route_iter++) {
+    const std::vector<Stop *>& stops = (*route_iter)->GetStops();
+    for (size_t i = 0; i < stops.size(); i++) {
+      num_waiting += stops[i]->GetNumPassengers();
+    }
+  }
+
+  int num_riding = 0;
+  for (std::list<Bus *>::iterator bus_iter = active_buses_.begin();
+      bus_iter != active_buses_.end(); bus_iter++) {
+    num_riding += static_cast<int>((*bus_iter)->GetNumPassengers());
+  }
+
+  out << "Time " << time << ": " << active_buses_.size() << " busses, "
+      << num_waiting << " waiting, " << num_riding << " riding\n";
+}
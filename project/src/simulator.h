@@ -6,6 +6,7 @@
 #ifndef SRC_SIMULATOR_H_
 #define SRC_SIMULATOR_H_
 
+#include <iostream>
 #include <list>
 #include <vector>
 
@@ -13,13 +14,41 @@
 #include "src/stop.h"
 #include "src/route.h"
 #include "src/passenger_generator.h"
+#include "src/report_level.h"
+#include "src/trace_writer.h"
+#include "src/web_interface.h"
 
 class Simulator {
  public:
   virtual bool Start() = 0;
   virtual bool Update() = 0;
+  /**
+  * @brief Sets how much Start() and Update() write, including generators.
+  * @param[in] ReportLevel to use from now on.
+  */
+  void SetReportLevel(ReportLevel);
+  /**
+  * @brief Records every Report() of Start() and Update() to a binary trace too.
+  * @param[in] TraceWriter * to record to, still owned by the caller, or NULL to stop.
+  */
+  void SetTrace(TraceWriter *);
+  /**
+  * @brief Sends the routes from Start() and every route and bus after each Update() to a visualizer.
+  * @param[in] WebInterface * to send to, still owned by the caller, or NULL to stop.
+  */
+  void SetWebInterface(WebInterface *);
 
  protected:
+  /**
+  * @brief Writes one line with time, bus count, waiting and riding passengers.
+  * @param[in] ostream to write to.
+  * @param[in] int holding current time step.
+  */
+  void ReportSummary(std::ostream&, int);
+
+  ReportLevel report_level_ = kReportFull;  ///< full keeps the old output
+  TraceWriter * trace_ = NULL;  ///< binary copy of the reports, if any
+  WebInterface * web_interface_ = NULL;  ///< visualizer fed each update, if any
   // bus and stop list will be iterated over to update
   // ist is efficient in traversal
   std::list<Bus *> active_buses_;         // buses leave scope
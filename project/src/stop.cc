@@ -12,32 +12,56 @@
 #include <iostream>
 #include <vector>
 
+#include "src/passenger_pool.h"
+#include "src/trace_writer.h"
+
 Stop::Stop(int id, double longitude, double latitude) :
-           id_(id), longitude_(longitude), latitude_(latitude) {
+           id_(id), queues_(1), clocks_(1, 0),
+           longitude_(longitude), latitude_(latitude), num_denied_(0) {
   // Defaults to Westbound Coffman Union stop
-  // no initialization of list of passengers necessary
+  // queue 0 exists up front for passengers added without a route
+}
+
+// routes register while the network is built, before any generation,
+// so queues_ never grows while generators are adding to it
+int Stop::AddRoute(const std::string& name) {
+  // a stop is served by a handful of routes, a scan is enough
+  for (int i = 0; i < static_cast<int>(route_names_.size()); i++) {
+    if (route_names_[i] == name) {
+      return i;
+    }
+  }
+  route_names_.push_back(name);
+  if (route_names_.size() > queues_.size()) {
+    queues_.push_back(std::list<Passenger *>());
+    clocks_.push_back(0);
+  }
+  return static_cast<int>(route_names_.size()) - 1;
 }
 
-// add new passenger to the back of the passengers_ list
-int Stop::AddPassengers(Passenger * pass) {
-  passengers_.push_back(pass);
+// add new passenger to the back of the route's list
+int Stop::AddPassengers(Passenger * pass, int queue) {
+  queues_[queue].push_back(pass);
+  pass->SetClock(&clocks_[queue]);
   return 1;
 }
 
 // load passengers on bus until bus is full or no passengers remain
-bool Stop::LoadPassengers(Bus * bus) {
+bool Stop::LoadPassengers(Bus * bus, int queue) {
+    std::list<Passenger *>& passengers = queues_[queue];
     Passenger *pass;
     bool loaded = false;
     // continue loaded while there are still passengers are stop
-    while (passengers_.empty() != 1) {
-      pass = passengers_.front();
+    while (passengers.empty() != 1) {
+      pass = passengers.front();
       // bus will return false if passenger can't fit
       if (bus->LoadPassenger(pass)) {
         pass->GetOnBus();
-        passengers_.pop_front();
+        passengers.pop_front();
         loaded = true;
       } else {
-        // exit loop if bus is full
+        // exit loop if bus is full, everyone still here was turned away
+        num_denied_ += static_cast<int>(passengers.size());
         break;
       }
     }
@@ -46,10 +70,29 @@ bool Stop::LoadPassengers(Bus * bus) {
 }
 
 void Stop::Update() {
-  // Update each Passenger waiting at Stop
-  for (std::list<Passenger *>::iterator it = passengers_.begin();
-       it != passengers_.end(); it++) {
-    (*it)->Update();
+  for (int i = 0; i < static_cast<int>(queues_.size()); i++) {
+    Update(i);
+  }
+}
+
+// waiting passengers time themselves from the queue's clock
+void Stop::Update(int queue) {
+  clocks_[queue]++;
+}
+
+void Stop::Advance(int steps) {
+  for (int i = 0; i < static_cast<int>(clocks_.size()); i++) {
+    clocks_[i] += steps;
+  }
+}
+
+void Stop::ReleasePassengers() {
+  for (int i = 0; i < static_cast<int>(queues_.size()); i++) {
+    for (std::list<Passenger *>::iterator it = queues_[i].begin();
+         it != queues_[i].end(); it++) {
+      PassengerPool::Release(*it);
+    }
+    queues_[i].clear();
   }
 }
 
@@ -59,11 +102,23 @@ int Stop::GetId() const {
 }
 
 void Stop::Report(std::ostream& os) const {
-  os << "ID: " << id_ << std::endl;
-  os << "Passengers waiting: " << passengers_.size() << std::endl;
-  for (std::list<Passenger *>::const_iterator it = passengers_.begin();
-      it != passengers_.end(); it++) {
-    (*it)->Report();
+  os << "ID: " << id_ << "\n";
+  os << "Passengers waiting: " << GetNumPassengers() << "\n";
+  for (size_t i = 0; i < queues_.size(); i++) {
+    for (std::list<Passenger *>::const_iterator it = queues_[i].begin();
+        it != queues_[i].end(); it++) {
+      (*it)->Report();
+    }
+  }
+}
+
+void Stop::Trace(TraceWriter * trace) const {
+  trace->WriteStop(id_, GetNumPassengers());
+  for (size_t i = 0; i < queues_.size(); i++) {
+    for (std::list<Passenger *>::const_iterator it = queues_[i].begin();
+        it != queues_[i].end(); it++) {
+      (*it)->Trace(trace);
+    }
   }
 }
 
@@ -72,7 +127,11 @@ std::tuple<double, double> Stop::GetCoordinates() {
   return std::make_tuple(longitude_, latitude_);
 }
 
-// number of passengers currently at stop
-int Stop::GetNumPassengers() {
-  return passengers_.size();
+// number of passengers currently at stop, for every route
+int Stop::GetNumPassengers() const {
+  int num_passengers = 0;
+  for (size_t i = 0; i < queues_.size(); i++) {
+    num_passengers += queues_[i].size();
+  }
+  return num_passengers;
 }
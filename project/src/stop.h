@@ -11,14 +11,18 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <deque>
 #include <list>
 #include <iostream>
+#include <string>
 #include <tuple>
+#include <vector>
 
 #include "src/bus.h"
 #include "src/passenger.h"
 
 class Bus;
+class TraceWriter;
 
 /*******************************************************************************
  * Class Definitions
@@ -27,7 +31,8 @@ class Bus;
  * @brief The main class for the representation of stops.
  *
  * Holds information about location of stop.
- *  Contains a list of passengers waiting to board bus.
+ *  Contains a list of passengers waiting to board bus for each route serving the stop,
+ *  so a stop shared by several routes only boards passengers onto buses of their own route.
  * 
  */
 class Stop {
@@ -50,31 +55,72 @@ class Stop {
   */
   int GetId() const;
   /**
+  * @brief Gives a route serving this stop its own passenger queue.
+  *
+  * The first route gets queue 0, which is also the queue used by callers that pass none.
+  *  A route registering again under the same name gets its old queue back.
+  *
+  * @param[in] string holding name of route.
+  * @return int index of the route's queue.
+  */
+  int AddRoute(const std::string&);
+  /**
   * @brief Add passenger to list of passengers.
   * @param[out] Passenger which will be added to list of stop.
+  * @param[in] int holding queue of the route the passenger will ride.
   * @return 1 marking successful method call.
   * 
   */
-  int AddPassengers(Passenger *);
+  int AddPassengers(Passenger *, int = 0);
   /**
   * @brief Remove passengers from stop and add to bus as long as bus has room.
   * @param[out] Bus where passengers will be loaded.
+  * @param[in] int holding queue of the route the bus is on.
   * @return bool indicating whether passengers were able to be loaded to bus.
   * 
   */
-  bool LoadPassengers(Bus *);
+  bool LoadPassengers(Bus *, int = 0);
   /**
-  * @brief Calls Update() on each passenger waiting at stop.
+  * @brief Adds a time step to the wait of each passenger waiting at stop.
   * 
   */
   void Update();
   /**
+  * @brief Adds a time step to the wait of each passenger waiting for one route.
+  *
+  * Only the queue's clock moves, passengers read it when asked for their wait.
+  *  Routes sharing the stop each update their own queue, so every passenger is updated once.
+  *
+  * @param[in] int holding queue of the route.
+  */
+  void Update(int);
+  /**
+  * @brief Adds several time steps to the wait of each passenger waiting, in one go.
+  *
+  * For simulators that leave a stop alone until a bus or a report needs its waits.
+  *
+  * @param[in] int holding number of time steps.
+  */
+  void Advance(int);
+  /**
+  * @brief Sends every waiting passenger back to the PassengerPool, for a stop about to be deleted.
+  *
+  * Only for stops whose passengers came from the pool or new, like those a generator adds.
+  */
+  void ReleasePassengers();
+  /**
   * @brief Outputs id_, number of passengers waiting, and calls Report() on all passengers in list.
   * @param[in] ostream used to output information.
   * 
   */
   void Report(std::ostream&) const;
   /**
+  * @brief Records what Report() prints to a binary trace.
+  * @param[in] TraceWriter * receiving the records.
+  *
+  */
+  void Trace(TraceWriter *) const;
+  /**
   * @brief Returns longitude and latitude as a tuple to be used in structs.
   * @return tuple<double, double> of longitude and latitude.
   * 
@@ -85,13 +131,24 @@ class Stop {
   * @return int representing number of passengers at stop.
   * 
   */
-  int GetNumPassengers();
+  int GetNumPassengers() const;
+  /**
+  * @brief Returns boardings denied, each passenger counted once per full bus that left them.
+  * @return int of passengers left waiting by LoadPassengers().
+  *
+  */
+  int GetNumDenied() const { return num_denied_; }
 
  private:
   int id_;  ///< index of stop
-  std::list<Passenger *> passengers_;  // considered array, vector, queue, list
+  /// passengers waiting, one list per route from AddRoute()
+  std::vector<std::list<Passenger *>> queues_;
+  std::vector<std::string> route_names_;  ///< route owning each queue
+  /// updates of each queue, a deque so passengers' pointers survive AddRoute()
+  std::deque<int> clocks_;
   double longitude_;  ///< x coordinate of stop
   double latitude_;  ///< y coordinate of stop
-  int passengers_present_;  ///< unused variable due to passengers_.size()
+  int passengers_present_;  ///< unused variable due to GetNumPassengers()
+  int num_denied_;  ///< passengers left behind by full busses so far
 };
 #endif  // SRC_STOP_H_
@@ -0,0 +1,336 @@
+/**
+ * @file sweep_runner.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+/*******************************************************************************
+* Includes
+******************************************************************************/
+#include "src/sweep_runner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <thread>
+
+#include "src/config_manager.h"
+#include "src/configuration_simulator.h"
+#include "src/passenger_generator.h"
+#include "src/phase_profiler.h"
+#include "src/random_passenger_generator.h"
+#include "src/route.h"
+#include "src/service_kpis.h"
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+static std::string Trim(const std::string& text) {
+  size_t start = text.find_first_not_of(" \t\r");
+  if (start == std::string::npos) {
+    return "";
+  }
+  size_t end = text.find_last_not_of(" \t\r");
+  return text.substr(start, end - start + 1);
+}
+
+static std::vector<std::string> Split(const std::string& text, char by) {
+  std::vector<std::string> fields;
+  std::istringstream in(text);
+  std::string field;
+  while (std::getline(in, field, by)) {
+    fields.push_back(Trim(field));
+  }
+  return fields;
+}
+
+// whole field must be a number greater than 0
+static bool ParsePositiveInt(const std::string& field, int * value) {
+  char * end;
+  long parsed = strtol(field.c_str(), &end, 10);  // NOLINT(runtime/int)
+  if (field.empty() || *end != '\0' || parsed <= 0 || parsed > 1 << 30) {
+    return false;
+  }
+  *value = static_cast<int>(parsed);
+  return true;
+}
+
+static bool ParsePositiveDouble(const std::string& field, double * value) {
+  char * end;
+  double parsed = strtod(field.c_str(), &end);
+  if (field.empty() || *end != '\0' || !(parsed > 0)) {
+    return false;
+  }
+  *value = parsed;
+  return true;
+}
+
+static std::string JoinIntervals(const std::vector<int>& intervals) {
+  std::string joined;
+  for (size_t i = 0; i < intervals.size(); i++) {
+    if (i > 0) {
+      joined += "/";
+    }
+    joined += std::to_string(intervals[i]);
+  }
+  return joined;
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+bool SweepRunner::ReadGrid(const std::string& filename) {
+  std::string path = "config/" + filename;
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    AddError(path, 0, "file not found");
+    return false;
+  }
+  std::ostringstream text;
+  text << file.rdbuf();
+  return ParseGrid(text.str(), path);
+}
+
+bool SweepRunner::ParseGrid(const std::string& text,
+                            const std::string& source) {
+  size_t num_errors = errors_.size();
+  std::vector<std::string> configs;
+  std::vector<std::vector<int>> intervals;
+  std::vector<int> capacities;
+  std::vector<double> speeds;
+  std::vector<int> rounds;
+  std::vector<unsigned int> seeds;
+
+  std::istringstream lines(text);
+  std::string line;
+  int line_number = 0;
+  while (std::getline(lines, line)) {
+    line_number++;
+    line = Trim(line);
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::vector<std::string> fields = Split(line, ',');
+    const std::string& key = fields[0];
+    if (fields.size() < 2) {
+      AddError(source, line_number, key + " row lists no values");
+      continue;
+    }
+    for (size_t i = 1; i < fields.size(); i++) {
+      const std::string& field = fields[i];
+      bool ok = true;
+      int int_value;
+      double double_value;
+      if (key == "CONFIG") {
+        ok = !field.empty();
+        configs.push_back(field);
+      } else if (key == "INTERVAL") {
+        std::vector<std::string> parts = Split(field, '/');
+        std::vector<int> per_pair;
+        for (size_t j = 0; ok && j < parts.size(); j++) {
+          ok = ParsePositiveInt(parts[j], &int_value);
+          per_pair.push_back(int_value);
+        }
+        ok = ok && !per_pair.empty();
+        intervals.push_back(per_pair);
+      } else if (key == "CAPACITY") {
+        ok = ParsePositiveInt(field, &int_value);
+        capacities.push_back(int_value);
+      } else if (key == "SPEED") {
+        ok = ParsePositiveDouble(field, &double_value);
+        speeds.push_back(double_value);
+      } else if (key == "ROUNDS") {
+        ok = ParsePositiveInt(field, &int_value);
+        rounds.push_back(int_value);
+      } else if (key == "SEED") {
+        // any whole number is a seed, 0 included
+        char * end;
+        unsigned long seed = strtoul(field.c_str(), &end, 10);  // NOLINT
+        ok = !field.empty() && *end == '\0';
+        seeds.push_back(static_cast<unsigned int>(seed));
+      } else {
+        AddError(source, line_number, "unknown row " + key);
+        break;
+      }
+      if (!ok) {
+        AddError(source, line_number, key + " has a bad value " + field);
+      }
+    }
+  }
+  if (configs.empty()) {
+    AddError(source, 0, "no CONFIG row");
+  }
+  if (errors_.size() != num_errors) {
+    return false;
+  }
+
+  // rows missing from the grid keep the defaults
+  Scenario defaults;
+  if (intervals.empty()) intervals.push_back(defaults.intervals);
+  if (capacities.empty()) capacities.push_back(defaults.capacity);
+  if (speeds.empty()) speeds.push_back(defaults.speed);
+  if (rounds.empty()) rounds.push_back(defaults.rounds);
+  if (seeds.empty()) seeds.push_back(defaults.seed);
+
+  for (const std::string& config : configs) {
+    for (const std::vector<int>& interval : intervals) {
+      for (int capacity : capacities) {
+        for (double speed : speeds) {
+          for (int num_rounds : rounds) {
+            for (unsigned int seed : seeds) {
+              Scenario scenario;
+              scenario.config = config;
+              scenario.intervals = interval;
+              scenario.capacity = capacity;
+              scenario.speed = speed;
+              scenario.rounds = num_rounds;
+              scenario.seed = seed;
+              scenarios_.push_back(scenario);
+            }
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+void SweepRunner::AddScenario(const Scenario& scenario) {
+  scenarios_.push_back(scenario);
+}
+
+bool SweepRunner::Run(std::ostream& out, int num_threads) {
+  // each config is read once, every scenario parses its own copy
+  std::map<std::string, std::string> texts;
+  bool ok = true;
+  for (const Scenario& scenario : scenarios_) {
+    if (texts.count(scenario.config) > 0) {
+      continue;
+    }
+    std::string path = "config/" + scenario.config;
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+      AddError(path, 0, "file not found");
+      ok = false;
+      continue;
+    }
+    std::ostringstream text;
+    text << file.rdbuf();
+    texts[scenario.config] = text.str();
+  }
+  if (!ok) {
+    return false;
+  }
+
+  out << "scenario,config,intervals,capacity,speed,seed,rounds,seconds,"
+      << "generated,boarded,alighted,spawned,retired,busses_at_end,"
+      << "wait_mean,wait_p50,wait_p95,ride_mean,ride_p95,load_mean,denied\n";
+
+  if (num_threads <= 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  // every generator reads this level, so it is set once before any run
+  PassengerGenerator::SetReportLevel(kReportNone);
+
+  int num_scenarios = static_cast<int>(scenarios_.size());
+  std::vector<std::string> rows(num_scenarios);
+  std::vector<char> done(num_scenarios, 0);
+  int next_row = 0;
+  // scenarios differ a lot in length, so threads take one at a time
+  #pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+  for (int i = 0; i < num_scenarios; i++) {
+    std::string row = RunScenario(i,
+                                  texts.find(scenarios_[i].config)->second);
+    // rows are written as soon as every earlier one is, in grid order
+    #pragma omp critical(sweep_output)
+    {
+      rows[i] = row;
+      done[i] = 1;
+      while (next_row < num_scenarios && done[next_row]) {
+        out << rows[next_row];
+        rows[next_row].clear();
+        next_row++;
+      }
+      out.flush();
+    }
+  }
+  return true;
+}
+
+std::string SweepRunner::RunScenario(int index,
+                                     const std::string& config_text) const {
+  const Scenario& scenario = scenarios_[index];
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+
+  ConfigManager cm;
+  // generators take their streams from one master seed as they are built,
+  // so configs are parsed one at a time
+  #pragma omp critical(sweep_config)
+  {
+    RandomPassengerGenerator::SetMasterSeed(scenario.seed);
+    cm.ParseConfig(config_text, scenario.config);
+  }
+
+  int num_pairs = static_cast<int>(cm.GetRoutes().size()) / 2;
+  std::vector<int> intervals(num_pairs);
+  int last = static_cast<int>(scenario.intervals.size()) - 1;
+  for (int i = 0; i < num_pairs; i++) {
+    intervals[i] = last < 0 ? Scenario().intervals[0]
+                            : scenario.intervals[i < last ? i : last];
+  }
+
+  PhaseProfiler profiler;
+  ServiceKpis kpis;
+  int busses_at_end;
+  {
+    ConfigurationSimulator sim(&cm);
+    // Run() already quieted the generators, whose level is shared
+    sim.SetOwnReportLevel(kReportNone);
+    sim.SetProfiler(&profiler);
+    sim.SetKpis(&kpis);
+    sim.SetBusParameters(scenario.capacity, scenario.speed);
+    sim.Start(intervals, scenario.rounds);
+    for (int i = 0; i < scenario.rounds; i++) {
+      sim.Update();
+    }
+    busses_at_end = sim.GetNumBusses();
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start).count();
+
+  // built up as a stream, since a long interval list has no length limit
+  std::ostringstream row;
+  row << index << "," << scenario.config << ","
+      << JoinIntervals(scenario.intervals) << "," << scenario.capacity << ","
+      << scenario.speed << "," << scenario.seed << "," << scenario.rounds
+      << "," << std::fixed << std::setprecision(4) << seconds << ","
+      << profiler.GetTotalCount(PhaseProfiler::kGenerated) << ","
+      << profiler.GetTotalCount(PhaseProfiler::kBoarded) << ","
+      << profiler.GetTotalCount(PhaseProfiler::kAlighted) << ","
+      << profiler.GetTotalCount(PhaseProfiler::kSpawned) << ","
+      << profiler.GetTotalCount(PhaseProfiler::kRetired) << ","
+      << busses_at_end << "," << std::setprecision(3)
+      << kpis.GetWaitAtStop().GetMean() << ","
+      << kpis.GetWaitAtStop().GetPercentile(50) << ","
+      << kpis.GetWaitAtStop().GetPercentile(95) << ","
+      << kpis.GetRideTime().GetMean() << ","
+      << kpis.GetRideTime().GetPercentile(95) << "," << std::setprecision(2)
+      << kpis.GetBusLoad().GetMean() << ","
+      << ServiceKpis::GetNumDenied(cm.GetStops()) << "\n";
+  return row.str();
+}
+
+void SweepRunner::AddError(const std::string& source, int line_number,
+                           const std::string& message) {
+  std::string error = source + ": " + message;
+  if (line_number > 0) {
+    error = source + ":" + std::to_string(line_number) + ": " + message;
+  }
+  std::cerr << error << std::endl;
+  errors_.push_back(error);
+}
@@ -0,0 +1,99 @@
+/**
+ * @file sweep_runner.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_SWEEP_RUNNER_H_
+#define SRC_SWEEP_RUNNER_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief One ConfigurationSimulator run of a sweep.
+ */
+struct Scenario {
+  std::string config;  ///< file name inside the config directory
+  /// bus interval per route pair, the last one repeats for later pairs
+  std::vector<int> intervals = std::vector<int>(1, 5);
+  int capacity = 60;  ///< passengers each bus holds
+  double speed = 1;  ///< distance each bus travels per time step
+  unsigned int seed = 1;  ///< master seed of the passenger generators
+  int rounds = 500;  ///< time steps simulated
+};
+
+/**
+ * @brief Runs every combination of a grid of scenarios on all cores and writes one CSV row of KPIs each.
+ *
+ * A grid is a text file with one row per parameter, each listing the values to try:
+ *
+ *     CONFIG, config.txt, big.txt
+ *     INTERVAL, 5, 10, 3/8
+ *     CAPACITY, 40, 60
+ *     SPEED, 1
+ *     SEED, 1, 2, 3
+ *     ROUNDS, 500
+ *
+ * An interval written as 3/8 gives the first route pair 3 and every later pair 8.
+ *  Missing rows keep the Scenario defaults, except CONFIG, which is required.
+ *
+ * Scenarios are independent simulators, one per thread. Each config is read once
+ *  and parsed again for every scenario, so no two share stops or passengers. Rows
+ *  come out in grid order, with CONFIG changing slowest, then INTERVAL, CAPACITY,
+ *  SPEED, ROUNDS and SEED, however the threads finish. Apart from the time
+ *  taken, the same grid always gives the same rows.
+ */
+class SweepRunner {
+ public:
+  /**
+  * @brief Reads config/<filename> and adds its combinations with ParseGrid().
+  * @param[in] string holding file name inside the config directory.
+  * @return bool false if the file is missing or has malformed rows.
+  */
+  bool ReadGrid(const std::string& filename);
+  /**
+  * @brief Adds every combination of the values listed in grid text.
+  *
+  * Malformed rows are reported with their line number on std::cerr and in GetErrors(), and add nothing.
+  *
+  * @param[in] string holding the whole grid.
+  * @param[in] string naming where the text came from, used in error messages.
+  * @return bool false if any row was malformed.
+  */
+  bool ParseGrid(const std::string& text, const std::string& source = "grid");
+  /**
+  * @brief Adds one scenario after those already added.
+  * @param[in] Scenario to run.
+  *
+  */
+  void AddScenario(const Scenario&);
+  /**
+  * @brief Runs every scenario and writes a header and one row per scenario.
+  * @param[in] ostream receiving the CSV.
+  * @param[in] int holding the number of threads, 0 for one per core.
+  * @return bool false, with nothing run, if a config file is missing.
+  */
+  bool Run(std::ostream& out, int num_threads = 0);
+
+  const std::vector<Scenario>& GetScenarios() const { return scenarios_; }
+  const std::vector<std::string>& GetErrors() const { return errors_; }
+
+ private:
+  // simulates one scenario from its config's text and returns its row
+  std::string RunScenario(int index, const std::string& config_text) const;
+  void AddError(const std::string& source, int line_number,
+                const std::string& message);
+
+  std::vector<Scenario> scenarios_;  ///< in the order rows are written
+  std::vector<std::string> errors_;  ///< "file:line: message" per bad row
+};
+
+#endif  // SRC_SWEEP_RUNNER_H_
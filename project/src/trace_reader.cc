@@ -0,0 +1,119 @@
+/**
+ * @file trace_reader.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+/*******************************************************************************
+* Includes
+******************************************************************************/
+#include "src/trace_reader.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+#include "src/trace_writer.h"
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+static bool GetInt(std::istream& in, int * value) {
+  int32_t raw;
+  if (!in.read(reinterpret_cast<char *>(&raw), sizeof(raw))) {
+    return false;
+  }
+  *value = raw;
+  return true;
+}
+
+static bool GetDouble(std::istream& in, double * value) {
+  return static_cast<bool>(in.read(reinterpret_cast<char *>(value),
+                                   sizeof(*value)));
+}
+
+static bool GetString(std::istream& in, std::string * value) {
+  int size;
+  if (!GetInt(in, &size) || size < 0) {
+    return false;
+  }
+  value->resize(size);
+  return size == 0 || static_cast<bool>(in.read(&(*value)[0], size));
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+bool TraceReader::ToText(const std::string& filename, std::ostream& out) {
+  std::ifstream in(filename.c_str(), std::ios::binary);
+  if (!in) {
+    return false;
+  }
+  return ToText(in, out);
+}
+
+// each record prints the lines its Report() would have printed
+bool TraceReader::ToText(std::istream& in, std::ostream& out) {
+  char magic[sizeof(TraceWriter::kMagic)];
+  int version;
+  if (!in.read(magic, sizeof(magic)) ||
+      memcmp(magic, TraceWriter::kMagic, sizeof(magic)) != 0 ||
+      !GetInt(in, &version) || version != TraceWriter::kVersion) {
+    return false;
+  }
+
+  std::unordered_map<int, std::string> names;
+  std::string text;
+  int a, b, c, d;
+  double speed, distance;
+  char tag;
+  while (in.get(tag)) {
+    switch (tag) {
+      case kTraceTick:
+        if (!GetInt(in, &a)) return false;
+        out << "~~~~~~~~~~~~~ The time is now " << a;
+        out << " ~~~~~~~~~~~~~\n";
+        break;
+      case kTraceRoute:
+        if (!GetString(in, &text) || !GetInt(in, &a)) return false;
+        out << "Name: " << text << "\n";
+        out << "Num stops: " << a << "\n";
+        break;
+      case kTraceStop:
+        if (!GetInt(in, &a) || !GetInt(in, &b)) return false;
+        out << "ID: " << a << "\n";
+        out << "Passengers waiting: " << b << "\n";
+        break;
+      case kTraceBus:
+        if (!GetString(in, &text) || !GetDouble(in, &speed) ||
+            !GetDouble(in, &distance) || !GetInt(in, &a)) return false;
+        out << "Name: " << text << "\n";
+        out << "Speed: " << speed << "\n";
+        out << "Distance to next stop: " << distance << "\n";
+        out << "\tPassengers (" << a << "): " << "\n";
+        break;
+      case kTraceName:
+        if (!GetInt(in, &a) || !GetString(in, &text)) return false;
+        names[a] = text;
+        break;
+      case kTracePassenger:
+        if (!GetInt(in, &a) || !GetInt(in, &b) || !GetInt(in, &c) ||
+            !GetInt(in, &d)) return false;
+        out << "Name: " << names[a] << "\n";
+        out << "Destination: " << b << "\n";
+        out << "Total Wait: " << c + d << "\n";
+        out << "\tWait at Stop: " << c << "\n";
+        out << "\tTime on bus: " << d << "\n";
+        break;
+      case kTraceText:
+        if (!GetString(in, &text)) return false;
+        out << text;
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
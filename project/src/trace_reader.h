@@ -0,0 +1,48 @@
+/**
+ * @file trace_reader.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_TRACE_READER_H_
+#define SRC_TRACE_READER_H_
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <iostream>
+#include <string>
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Converts a binary trace from TraceWriter back into Report() text.
+ *
+ * Routes, stops, buses and passengers come out exactly as their Report()
+ *  functions print them, and each tick as LocalSimulator::Update() announces it.
+ *  Like PassengerFactory, every call is static.
+ */
+class TraceReader {
+ public:
+ /**
+  * @brief Writes the text form of a trace file.
+  *
+  * @param[in] string holding trace file name.
+  * @param[out] ostream receiving the text.
+  *
+  * @return bool false if the file is missing, not a trace, or cut short.
+  */
+  static bool ToText(const std::string&, std::ostream&);
+ /**
+  * @brief Writes the text form of a trace already opened as a stream.
+  *
+  * @param[in] istream positioned at the start of the trace.
+  * @param[out] ostream receiving the text.
+  *
+  * @return bool false if the stream is not a trace or is cut short.
+  */
+  static bool ToText(std::istream&, std::ostream&);
+};
+#endif  // SRC_TRACE_READER_H_
@@ -0,0 +1,130 @@
+/**
+ * @file trace_writer.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+/*******************************************************************************
+* Includes
+******************************************************************************/
+#include "src/trace_writer.h"
+
+#include <cstring>
+
+#include "src/passenger_name_table.h"
+
+const char TraceWriter::kMagic[4] = {'B', 'T', 'R', 'C'};
+const int TraceWriter::kVersion;
+const size_t TraceWriter::kDefaultBufferSize;
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+TraceWriter::TraceWriter(const std::string& filename, size_t buffer_size)
+    : file_(fopen(filename.c_str(), "wb")), buffer_(buffer_size), used_(0) {
+  Put(kMagic, sizeof(kMagic));
+  PutInt(kVersion);
+}
+
+TraceWriter::~TraceWriter() {
+  Flush();
+  if (file_) {
+    fclose(file_);
+  }
+}
+
+bool TraceWriter::IsOpen() const {
+  return file_ != NULL;
+}
+
+void TraceWriter::WriteTick(int time) {
+  PutTag(kTraceTick);
+  PutInt(time);
+}
+
+void TraceWriter::WriteRoute(const std::string& name, int num_stops) {
+  PutTag(kTraceRoute);
+  PutString(name);
+  PutInt(num_stops);
+}
+
+void TraceWriter::WriteStop(int id, int num_waiting) {
+  PutTag(kTraceStop);
+  PutInt(id);
+  PutInt(num_waiting);
+}
+
+void TraceWriter::WriteBus(const std::string& name, double speed,
+                           double distance, int num_passengers) {
+  PutTag(kTraceBus);
+  PutString(name);
+  PutDouble(speed);
+  PutDouble(distance);
+  PutInt(num_passengers);
+}
+
+// names are stored once per trace, passengers only carry the id
+void TraceWriter::WritePassenger(int name_id, int destination,
+                                 int wait_at_stop, int time_on_bus) {
+  if (name_id >= static_cast<int>(named_.size())) {
+    named_.resize(name_id + 1, false);
+  }
+  if (!named_[name_id]) {
+    PutTag(kTraceName);
+    PutInt(name_id);
+    PutString(PassengerNameTable::GetName(name_id));
+    named_[name_id] = true;
+  }
+  PutTag(kTracePassenger);
+  PutInt(name_id);
+  PutInt(destination);
+  PutInt(wait_at_stop);
+  PutInt(time_on_bus);
+}
+
+void TraceWriter::WriteText(const std::string& text) {
+  PutTag(kTraceText);
+  PutString(text);
+}
+
+void TraceWriter::Flush() {
+  if (file_ && used_ > 0) {
+    fwrite(buffer_.data(), 1, used_, file_);
+    fflush(file_);
+  }
+  used_ = 0;
+}
+
+// copy into the buffer, only going to the file when it is full
+void TraceWriter::Put(const void * data, size_t size) {
+  if (used_ + size > buffer_.size()) {
+    Flush();
+    // a record larger than the whole buffer skips it
+    if (size > buffer_.size()) {
+      if (file_) {
+        fwrite(data, 1, size, file_);
+      }
+      return;
+    }
+  }
+  memcpy(buffer_.data() + used_, data, size);
+  used_ += size;
+}
+
+void TraceWriter::PutTag(TraceRecord tag) {
+  uint8_t byte = static_cast<uint8_t>(tag);
+  Put(&byte, sizeof(byte));
+}
+
+void TraceWriter::PutInt(int32_t value) {
+  Put(&value, sizeof(value));
+}
+
+void TraceWriter::PutDouble(double value) {
+  Put(&value, sizeof(value));
+}
+
+void TraceWriter::PutString(const std::string& value) {
+  PutInt(static_cast<int32_t>(value.size()));
+  Put(value.data(), value.size());
+}
@@ -0,0 +1,125 @@
+/**
+ * @file trace_writer.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_TRACE_WRITER_H_
+#define SRC_TRACE_WRITER_H_
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/*******************************************************************************
+ * Constants
+ ******************************************************************************/
+/**
+ * @brief Tag written before each record of a binary trace.
+ *
+ * Integers are 32 bit and doubles 64 bit in host byte order, strings are a
+ *  32 bit length followed by the bytes.
+ */
+enum TraceRecord {
+  kTraceTick = 1,  ///< int time
+  kTraceRoute = 2,  ///< string name, int number of stops
+  kTraceStop = 3,  ///< int id, int passengers waiting
+  kTraceBus = 4,  ///< string name, double speed, double distance, int riders
+  kTracePassenger = 5,  ///< int name id, int destination, int wait, int ride
+  kTraceName = 6,  ///< int name id, string name, sent before its first use
+  kTraceText = 7  ///< string copied to the text form as is
+};
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Records what Report() would print into a compact binary file.
+ *
+ * Records are gathered in one large buffer and written with a single fwrite
+ *  when it fills, so a long capture costs a handful of system calls instead of
+ *  one flush per line. TraceReader turns a trace back into Report() text.
+ */
+class TraceWriter {
+ public:
+  static const char kMagic[4];  ///< first bytes of every trace file
+  static const int kVersion = 1;  ///< bumped when a record layout changes
+  static const size_t kDefaultBufferSize = 1 << 20;  ///< 1 MiB
+
+  /**
+  * @brief Opens a trace file for writing and writes its header.
+  * @param[in] string holding file name.
+  * @param[in] size_t holding number of bytes buffered between writes.
+  */
+  explicit TraceWriter(const std::string&,
+                       size_t = kDefaultBufferSize);
+  /**
+  * @brief Flushes remaining records and closes the file.
+  */
+  ~TraceWriter();
+  /**
+  * @brief Returns whether the file could be opened.
+  * @return bool true when records will reach the file.
+  */
+  bool IsOpen() const;
+  /**
+  * @brief Marks the start of a time step.
+  * @param[in] int holding simulation time.
+  */
+  void WriteTick(int);
+  /**
+  * @brief Records a route header, its stops follow as stop records.
+  * @param[in] string holding route name.
+  * @param[in] int holding number of stops.
+  */
+  void WriteRoute(const std::string&, int);
+  /**
+  * @brief Records a stop header, its passengers follow.
+  * @param[in] int holding stop id.
+  * @param[in] int holding number of passengers waiting.
+  */
+  void WriteStop(int, int);
+  /**
+  * @brief Records a bus header, its passengers follow.
+  * @param[in] string holding bus name.
+  * @param[in] double holding speed.
+  * @param[in] double holding distance to next stop.
+  * @param[in] int holding number of passengers on board.
+  */
+  void WriteBus(const std::string&, double, double, int);
+  /**
+  * @brief Records one passenger, preceded by its name the first time the id is seen.
+  * @param[in] int holding PassengerNameTable id of name.
+  * @param[in] int holding destination stop id.
+  * @param[in] int holding time waited at stop.
+  * @param[in] int holding time spent on bus.
+  */
+  void WritePassenger(int, int, int, int);
+  /**
+  * @brief Records free text such as the banners printed by the drivers.
+  * @param[in] string holding text, including its newlines.
+  */
+  void WriteText(const std::string&);
+  /**
+  * @brief Writes everything buffered so far to the file.
+  */
+  void Flush();
+
+ private:
+  void Put(const void *, size_t);
+  void PutTag(TraceRecord);
+  void PutInt(int32_t);
+  void PutDouble(double);
+  void PutString(const std::string&);
+
+  FILE * file_;  ///< null when the file could not be opened
+  std::vector<char> buffer_;  ///< records not yet written
+  size_t used_;  ///< bytes of buffer_ in use
+  std::vector<bool> named_;  ///< name ids already written
+};
+#endif  // SRC_TRACE_WRITER_H_
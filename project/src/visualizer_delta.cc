@@ -0,0 +1,276 @@
+/**
+ * @file visualizer_delta.cc
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+/*******************************************************************************
+* Includes
+******************************************************************************/
+#include "src/visualizer_delta.h"
+
+#include <cstdio>
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+static void AppendString(std::string * out, const std::string& value) {
+  out->push_back('"');
+  for (size_t i = 0; i < value.size(); i++) {
+    if (value[i] == '"' || value[i] == '\\') {
+      out->push_back('\\');
+    }
+    out->push_back(value[i]);
+  }
+  out->push_back('"');
+}
+
+// enough digits for a coordinate stored as a float
+static void AppendNumber(std::string * out, double value) {
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.7g", value);
+  out->append(buffer);
+}
+
+// positions are floats, so compare without == to keep -Wfloat-equal quiet
+static bool Moved(const Position& a, const Position& b) {
+  return a.x < b.x || a.x > b.x || a.y < b.y || a.y > b.y;
+}
+
+static void AppendHeader(std::string * out, const char * command, int version,
+                         bool delta) {
+  out->append("{\"command\":\"");
+  out->append(command);
+  out->append("\",\"version\":");
+  out->append(std::to_string(version));
+  out->append(delta ? ",\"delta\":1" : ",\"delta\":0");
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+VisualizerDelta::VisualizerDelta() : version_(0), removed_horizon_(0) {
+}
+
+void VisualizerDelta::UpdateBus(const BusData& data, bool deleted) {
+  std::unordered_map<std::string, int>::iterator found =
+      bus_index_.find(data.id);
+
+  if (deleted) {
+    if (found == bus_index_.end()) {
+      return;
+    }
+    // swap the last bus into the hole, busses_ has no order to keep
+    int index = found->second;
+    bus_index_.erase(found);
+    if (index != static_cast<int>(busses_.size()) - 1) {
+      busses_[index] = busses_.back();
+      bus_index_[busses_[index].data.id] = index;
+    }
+    busses_.pop_back();
+
+    removed_.push_back(std::make_pair(data.id, ++version_));
+    if (static_cast<int>(removed_.size()) > kMaxRemoved) {
+      int dropped = kMaxRemoved / 2;
+      removed_horizon_ = removed_[dropped - 1].second;
+      removed_.erase(removed_.begin(), removed_.begin() + dropped);
+    }
+    return;
+  }
+
+  if (found == bus_index_.end()) {
+    bus_index_[data.id] = static_cast<int>(busses_.size());
+    BusEntry entry;
+    entry.data = data;
+    entry.changed = ++version_;
+    busses_.push_back(entry);
+    return;
+  }
+  BusEntry& entry = busses_[found->second];
+  if (Moved(entry.data.position, data.position) ||
+      entry.data.num_passengers != data.num_passengers ||
+      entry.data.capacity != data.capacity) {
+    entry.data = data;
+    entry.changed = ++version_;
+  }
+}
+
+void VisualizerDelta::UpdateRoute(const RouteData& data, bool deleted) {
+  if (deleted) {
+    return;
+  }
+  std::unordered_map<std::string, int>::iterator found =
+      route_index_.find(data.id);
+  int num_stops = static_cast<int>(data.stops.size());
+
+  // a known route already has its stops' indices, a new one looks them up
+  if (found != route_index_.end() &&
+      static_cast<int>(routes_[found->second].stops.size()) == num_stops) {
+    const std::vector<int>& indices = routes_[found->second].stops;
+    for (int i = 0; i < num_stops; i++) {
+      StopEntry& stop = stops_[indices[i]];
+      if (stop.data.num_people != data.stops[i].num_people) {
+        stop.data.num_people = data.stops[i].num_people;
+        stop.changed = ++version_;
+      }
+    }
+    return;
+  }
+
+  RouteEntry route;
+  route.id = data.id;
+  route.added = ++version_;
+  for (int i = 0; i < num_stops; i++) {
+    const StopData& stop_data = data.stops[i];
+    std::unordered_map<std::string, int>::iterator stop =
+        stop_index_.find(stop_data.id);
+    if (stop == stop_index_.end()) {
+      StopEntry entry;
+      entry.data = stop_data;
+      entry.added = route.added;
+      entry.changed = route.added;
+      stop = stop_index_.insert(
+          std::make_pair(stop_data.id, static_cast<int>(stops_.size()))).first;
+      stops_.push_back(entry);
+    } else if (stops_[stop->second].data.num_people != stop_data.num_people) {
+      stops_[stop->second].data.num_people = stop_data.num_people;
+      stops_[stop->second].changed = ++version_;
+    }
+    route.stops.push_back(stop->second);
+  }
+
+  if (found == route_index_.end()) {
+    route_index_[data.id] = static_cast<int>(routes_.size());
+    routes_.push_back(route);
+  } else {
+    routes_[found->second] = route;
+  }
+}
+
+// busses as [id,x,y,passengers,capacity], then ids of busses removed
+std::string VisualizerDelta::GetBusses(int since) const {
+  // a version past ours came from a run before this one
+  bool delta = since >= removed_horizon_ && since <= version_;
+  std::string out;
+  AppendHeader(&out, "updateBusses", version_, delta);
+
+  out.append(",\"busses\":[");
+  bool first = true;
+  for (size_t i = 0; i < busses_.size(); i++) {
+    const BusEntry& entry = busses_[i];
+    if (delta && entry.changed <= since) {
+      continue;
+    }
+    if (!first) {
+      out.push_back(',');
+    }
+    first = false;
+    out.push_back('[');
+    AppendString(&out, entry.data.id);
+    out.push_back(',');
+    AppendNumber(&out, entry.data.position.x);
+    out.push_back(',');
+    AppendNumber(&out, entry.data.position.y);
+    out.push_back(',');
+    out.append(std::to_string(entry.data.num_passengers));
+    out.push_back(',');
+    out.append(std::to_string(entry.data.capacity));
+    out.push_back(']');
+  }
+  out.push_back(']');
+
+  if (delta) {
+    WriteRemoved(&out, since);
+  }
+  out.push_back('}');
+  return out;
+}
+
+void VisualizerDelta::WriteRemoved(std::string * out, int since) const {
+  out->append(",\"removed\":[");
+  bool first = true;
+  for (size_t i = 0; i < removed_.size(); i++) {
+    if (removed_[i].second <= since) {
+      continue;
+    }
+    if (!first) {
+      out->push_back(',');
+    }
+    first = false;
+    AppendString(out, removed_[i].first);
+  }
+  out->push_back(']');
+}
+
+// new stops as [id,x,y,people], changed counts of older stops as
+// [id,people], and new routes as [id,[stop ids]]
+std::string VisualizerDelta::GetRoutes(int since) const {
+  bool delta = since >= 0 && since <= version_;
+  std::string out;
+  AppendHeader(&out, "updateRoutes", version_, delta);
+
+  out.append(",\"stops\":[");
+  bool first = true;
+  for (size_t i = 0; i < stops_.size(); i++) {
+    const StopEntry& entry = stops_[i];
+    if (delta && entry.added <= since) {
+      continue;
+    }
+    if (!first) {
+      out.push_back(',');
+    }
+    first = false;
+    out.push_back('[');
+    AppendString(&out, entry.data.id);
+    out.push_back(',');
+    AppendNumber(&out, entry.data.position.x);
+    out.push_back(',');
+    AppendNumber(&out, entry.data.position.y);
+    out.push_back(',');
+    out.append(std::to_string(entry.data.num_people));
+    out.push_back(']');
+  }
+
+  out.append("],\"counts\":[");
+  first = true;
+  for (size_t i = 0; delta && i < stops_.size(); i++) {
+    const StopEntry& entry = stops_[i];
+    if (entry.added > since || entry.changed <= since) {
+      continue;
+    }
+    if (!first) {
+      out.push_back(',');
+    }
+    first = false;
+    out.push_back('[');
+    AppendString(&out, entry.data.id);
+    out.push_back(',');
+    out.append(std::to_string(entry.data.num_people));
+    out.push_back(']');
+  }
+
+  out.append("],\"routes\":[");
+  first = true;
+  for (size_t i = 0; i < routes_.size(); i++) {
+    const RouteEntry& route = routes_[i];
+    if (delta && route.added <= since) {
+      continue;
+    }
+    if (!first) {
+      out.push_back(',');
+    }
+    first = false;
+    out.push_back('[');
+    AppendString(&out, route.id);
+    out.append(",[");
+    for (size_t j = 0; j < route.stops.size(); j++) {
+      if (j > 0) {
+        out.push_back(',');
+      }
+      AppendString(&out, stops_[route.stops[j]].data.id);
+    }
+    out.append("]]");
+  }
+  out.append("]}");
+  return out;
+}
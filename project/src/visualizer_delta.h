@@ -0,0 +1,106 @@
+/**
+ * @file visualizer_delta.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_VISUALIZER_DELTA_H_
+#define SRC_VISUALIZER_DELTA_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "src/data_structs.h"
+#include "src/web_interface.h"
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Server side of the visualizer's delta mode for getBusses and getRoutes.
+ *
+ * A WebInterface that stamps each bus and stop with a version, counted up by
+ *  every change it records. Each message carries the version it is current to;
+ *  a client asks with the version of the last message it applied and gets only
+ *  what changed after it, as minified JSON with one array per bus or stop.
+ *  Changes made between two requests, even within one time step, get versions
+ *  above the first reply's, so requests may come at any point of a simulation.
+ *  A client with no version, one too far behind, or one from another run gets
+ *  everything with "delta":0 and starts over from it.
+ */
+class VisualizerDelta : public WebInterface {
+ public:
+  VisualizerDelta();
+
+  int GetVersion() const { return version_; }
+  /**
+  * @brief Records the latest state of a bus.
+  * @param[in] BusData of the bus.
+  * @param[in] bool set when the bus has finished and leaves the display.
+  *
+  */
+  void UpdateBus(const BusData&, bool = false) override;
+  /**
+  * @brief Records a route and the number of people at its stops.
+  *
+  * Stops shared between routes are stored once, by id. Routes never leave
+  *  the display, so a deleted route is ignored.
+  *
+  * @param[in] RouteData of the route.
+  * @param[in] bool set when the route leaves the display.
+  */
+  void UpdateRoute(const RouteData&, bool = false) override;
+  /**
+  * @brief Encodes busses changed or removed after a version.
+  * @param[in] int holding the client's last applied version, negative for everything.
+  * @return string holding an "updateBusses" message.
+  *
+  */
+  std::string GetBusses(int) const;
+  /**
+  * @brief Encodes routes and stops added, and stop counts changed, after a version.
+  * @param[in] int holding the client's last applied version, negative for everything.
+  * @return string holding an "updateRoutes" message.
+  *
+  */
+  std::string GetRoutes(int) const;
+
+ private:
+  struct BusEntry {
+    BusData data;
+    int changed;  ///< version of the last change
+  };
+  struct StopEntry {
+    StopData data;
+    int added;  ///< version the stop was first seen at
+    int changed;  ///< version num_people last changed at
+  };
+  struct RouteEntry {
+    std::string id;
+    std::vector<int> stops;  ///< indices into stops_
+    int added;  ///< version the route was first seen at
+  };
+
+  void WriteRemoved(std::string * out, int since) const;
+
+  int version_;  ///< stamp of the latest change, 0 before any
+  std::vector<BusEntry> busses_;  ///< busses on display, in no order
+  std::unordered_map<std::string, int> bus_index_;  ///< id to busses_ index
+  // removed bus ids with the version they left at, oldest first
+  std::vector<std::pair<std::string, int>> removed_;
+  int removed_horizon_;  ///< removals up to this version were dropped
+  std::vector<StopEntry> stops_;
+  std::unordered_map<std::string, int> stop_index_;  ///< id to stops_ index
+  std::vector<RouteEntry> routes_;
+  std::unordered_map<std::string, int> route_index_;  ///< id to routes_ index
+
+  /// removals kept for clients that are behind, older ones force a full send
+  static const int kMaxRemoved = 4096;
+};
+
+#endif  // SRC_VISUALIZER_DELTA_H_
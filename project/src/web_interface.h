@@ -0,0 +1,42 @@
+/**
+ * @file web_interface.h
+ *
+ * @copyright 2019 3081 Staff, All rights reserved.
+ */
+
+#ifndef SRC_WEB_INTERFACE_H_
+#define SRC_WEB_INTERFACE_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "src/data_structs.h"
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief What a simulator tells the visualizer about its routes and busses.
+ *
+ * Simulators call it after each update with the latest RouteData and BusData.
+ */
+class WebInterface {
+ public:
+  virtual ~WebInterface() {}
+  /**
+  * @brief Receives the latest state of a route and its stops.
+  * @param[in] RouteData of the route.
+  * @param[in] bool set when the route leaves the display.
+  *
+  */
+  virtual void UpdateRoute(const RouteData&, bool = false) = 0;
+  /**
+  * @brief Receives the latest state of a bus.
+  * @param[in] BusData of the bus.
+  * @param[in] bool set when the bus has finished and leaves the display.
+  *
+  */
+  virtual void UpdateBus(const BusData&, bool = false) = 0;
+};
+
+#endif  // SRC_WEB_INTERFACE_H_
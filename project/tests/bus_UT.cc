@@ -134,6 +134,37 @@ TEST_F(BusTests, UnloadPassengers) {
   EXPECT_EQ(bus->GetNumPassengers(), 1);
 }
 
+TEST_F(BusTests, BulkUnload) {
+  Bus * big = new Bus("big", out->Clone(), in->Clone(), 10, 1);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_TRUE(big->LoadPassenger(new Passenger(2, "to in 1")));
+  }
+  EXPECT_TRUE(big->LoadPassenger(new Passenger(1, "to out 2")));
+  EXPECT_TRUE(big->LoadPassenger(new Passenger(3, "to in 2")));
+  EXPECT_EQ(big->GetNumPassengers(), 5);
+
+  // everyone for a stop leaves at once, and nobody else does
+  EXPECT_TRUE(big->UnloadPassengers(stop_in_1));
+  EXPECT_EQ(big->GetNumPassengers(), 2);
+  EXPECT_EQ(big->GetNumAlighted(), 3);
+  EXPECT_FALSE(big->UnloadPassengers(stop_in_1));
+  // the last outgoing stop is never visited, its riders still leave if asked
+  EXPECT_TRUE(big->UnloadPassengers(stop_out_2));
+  EXPECT_EQ(big->GetNumPassengers(), 1);
+
+  // an emptied bucket fills again, and empties again when the bus gets there
+  EXPECT_TRUE(big->LoadPassenger(new Passenger(2, "to in 1")));
+  EXPECT_TRUE(big->LoadPassenger(new Passenger(2, "to in 1")));
+  while (big->GetNextStop() != stop_in_2) {
+    big->Move();
+  }
+  EXPECT_EQ(big->GetNumAlighted(), 6);
+  // left on board: the rider for in 2 and kevin, who boarded at out 1
+  EXPECT_EQ(big->GetNumPassengers(), 2);
+  big->Reclaim();
+  delete big;
+}
+
 TEST_F(BusTests, NextStop) {
   // SetUp();
   // bus starts on way to first stop
@@ -145,8 +176,8 @@ TEST_F(BusTests, NextStop) {
   bus->Move();
   // bus now on incoming route
   EXPECT_EQ(bus->GetNextStop(), stop_in_1);
-  bus->Move();
-  EXPECT_EQ(bus->GetNextStop(), stop_in_1);
+  // no distance left past the last outgoing stop, so the bus
+  // reaches the first incoming stop on the next move
   bus->Move();
   EXPECT_EQ(bus->GetNextStop(), stop_in_2);
   // bus should not move if at end of trip
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../src/bus.h"
+#include "../src/bus_fleet.h"
+#include "../src/config_manager.h"
+#include "../src/route.h"
+
+/******************************************************
+* TEST FEATURE SetUp
+*******************************************************/
+
+class BusFleetTests : public ::testing::Test {
+ protected:
+  ConfigManager* cm;
+  std::vector<Route *> routes;
+
+  virtual void SetUp() {
+    cm = new ConfigManager();
+    cm->ParseConfig(
+        "ROUTE, East Bound\n"
+        "STOP, A, 44.9730, -93.2354, 0\n"
+        "STOP, B, 44.9750, -93.2300, 0\n"
+        "STOP, C, 44.9800, -93.2250, 0\n"
+        "ROUTE, West Bound\n"
+        "STOP, C, 44.9800, -93.2250, 0\n"
+        "STOP, A, 44.9730, -93.2354, 0\n");
+    routes = cm->GetRoutes();
+  }
+
+  virtual void TearDown() {
+    delete cm;
+  }
+
+  Bus* NewBus(std::string name, double speed) {
+    return new Bus(name, routes[0]->Clone(), routes[1]->Clone(), 60, speed);
+  }
+
+  std::string Report(Bus* bus) {
+    std::ostringstream out;
+    bus->Report(out);
+    return out.str();
+  }
+};
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+
+TEST_F(BusFleetTests, MatchesBusUpdate) {
+  // the same busses stepped one at a time and as a fleet
+  std::vector<Bus *> single;
+  single.push_back(NewBus("slow", 0.01));
+  single.push_back(NewBus("fast", 0.5));
+  BusFleet fleet;
+  fleet.Add(NewBus("slow", 0.01));
+  fleet.Add(NewBus("fast", 0.5));
+
+  // stepped until the fast bus is back, well before the slow one
+
+  for (int step = 1; !single[1]->IsTripComplete() && step < 1000; step++) {
+    for (int i = 0; i < 2; i++) {
+      single[i]->UpdateTravel();
+    }
+    for (int i = 1; i >= 0; i--) {
+      single[i]->UpdateStop();
+    }
+    fleet.Advance();
+    fleet.VisitStops();
+    fleet.Sync();
+    ASSERT_EQ(fleet.GetSize(), 2);
+    for (int i = 0; i < 2; i++) {
+      EXPECT_EQ(Report(fleet.GetBus(i)), Report(single[i]))
+          << "bus " << i << " at step " << step;
+      EXPECT_EQ(fleet.GetBus(i)->IsTripComplete(),
+                single[i]->IsTripComplete());
+    }
+  }
+
+  // the finished bus is reclaimed and its slot left empty
+  fleet.RemoveCompleted();
+  EXPECT_EQ(fleet.GetNumBusses(), 1);
+  ASSERT_EQ(fleet.GetSize(), 2);
+  EXPECT_EQ(fleet.GetBus(0)->GetName(), "slow");
+  EXPECT_EQ(fleet.GetBus(1), static_cast<Bus *>(NULL));
+  for (int i = 0; i < 2; i++) {
+    single[i]->Reclaim();
+    delete single[i];
+  }
+}
+
+TEST_F(BusFleetTests, Compact) {
+  BusFleet fleet;
+  fleet.Add(NewBus("slow", 0.01));
+  fleet.Add(NewBus("fast", 0.5));
+  fleet.Add(NewBus("faster", 1));
+  while (fleet.GetNumBusses() > 1) {
+    fleet.Advance();
+    fleet.VisitStops();
+    fleet.RemoveCompleted();
+  }
+
+  // two empty slots out of three, so the survivor moves to the front
+  ASSERT_EQ(fleet.GetSize(), 1);
+  EXPECT_EQ(fleet.GetBus(0)->GetName(), "slow");
+}
+
+TEST_F(BusFleetTests, Positions) {
+  BusFleet fleet;
+  fleet.Add(NewBus("bus", 0.001));
+  const std::vector<StopData>& stops = routes[0]->GetRouteData().stops;
+  Bus* bus = fleet.GetBus(0);
+
+  // a new bus sits at the first stop
+  EXPECT_FLOAT_EQ(bus->GetBusData().position.x, stops[0].position.x);
+  EXPECT_FLOAT_EQ(bus->GetBusData().position.y, stops[0].position.y);
+
+  // once it leaves, it is drawn along the leg toward the second stop
+  while (bus->GetNextStop() != routes[0]->GetStops()[1]) {
+    fleet.Advance();
+    fleet.VisitStops();
+  }
+  fleet.Advance();
+  fleet.Sync();
+  Route* route = routes[0]->Clone();
+  route->NextStop();
+  double ahead = bus->GetDistanceRemaining() / route->GetSegment().length;
+  delete route;
+  EXPECT_GT(ahead, 0);
+  EXPECT_LT(ahead, 1);
+  float x = stops[1].position.x -
+            ahead * (stops[1].position.x - stops[0].position.x);
+  EXPECT_NEAR(bus->GetBusData().position.x, x, 1e-5);
+}
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "../src/config_manager.h"
+#include "../src/route.h"
+
+/******************************************************
+* TEST FEATURE SetUp
+*******************************************************/
+
+class ConfigManagerTests : public ::testing::Test {
+ protected:
+  ConfigManager* cm;
+
+  virtual void SetUp() {
+    cm = new ConfigManager();
+  }
+
+  virtual void TearDown() {
+    delete cm;
+  }
+};
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+
+TEST_F(ConfigManagerTests, ParseConfig) {
+  std::string text =
+      "ROUTE_GENERAL, Loop\r\n"
+      "Stop Name, Long, Lat, Pass Gen Prob\r\n"
+      "ROUTE, East Bound\r\n"
+      "STOP, A, 44.97, -93.24, .15\r\n"
+      "STOP, B, 44.98, -93.23, 0\r\n"
+      "ROUTE, West Bound\r\n"
+      "STOP, B, 44.98, -93.23, .2\r\n"
+      "STOP, A, 44.97, -93.24, 0";
+  EXPECT_TRUE(cm->ParseConfig(text));
+  std::vector<Route *> routes = cm->GetRoutes();
+  ASSERT_EQ(routes.size(), 2u);
+  EXPECT_EQ(routes[0]->GetName(), " Loop EastBound");
+  EXPECT_EQ(routes[1]->GetName(), " Loop WestBound");
+  EXPECT_EQ(routes[0]->GetStops().size(), 2u);
+  routes[0]->NextStop();
+  EXPECT_GT(routes[0]->GetTotalRouteDistance(), 0);
+  EXPECT_TRUE(cm->GetErrors().empty());
+
+  // A and B are listed on both routes but exist once
+  ASSERT_EQ(cm->GetStops().size(), 2u);
+  EXPECT_EQ(routes[0]->GetStops()[0], routes[1]->GetStops()[1]);
+  EXPECT_EQ(routes[0]->GetStops()[1], routes[1]->GetStops()[0]);
+  EXPECT_EQ(routes[0]->GetStops()[1]->GetId(), 11);
+}
+
+TEST_F(ConfigManagerTests, MalformedRows) {
+  std::string text =
+      "ROUTE, East Bound\n"
+      "STOP, A, 44.97, -93.24, .15\n"
+      "STOP, B, north, -93.23, 0\n"
+      "STOP, C, 44.99, -93.22\n"
+      "ROUTE,\n"
+      "STOP, D, 44.99, -93.22, 0\n";
+  EXPECT_FALSE(cm->ParseConfig(text, "test.txt"));
+  const std::vector<std::string>& errors = cm->GetErrors();
+  ASSERT_EQ(errors.size(), 3u);
+  EXPECT_EQ(errors[0], "test.txt:3: STOP B has a bad coordinate");
+  EXPECT_EQ(errors[1], "test.txt:4: STOP C has a bad probability");
+  EXPECT_EQ(errors[2], "test.txt:5: ROUTE row has no name");
+
+  // bad rows are skipped, the good ones still make routes
+  ASSERT_EQ(cm->GetRoutes().size(), 2u);
+  EXPECT_EQ(cm->GetRoutes()[0]->GetStops().size(), 1u);
+}
+
+TEST_F(ConfigManagerTests, Snapshot) {
+  std::string text =
+      "ROUTE_GENERAL, Loop\n"
+      "ROUTE, East Bound\n"
+      "STOP, A, 44.97, -93.24, .15\n"
+      "STOP, B, 44.98, -93.23, 0\n"
+      "ROUTE, West Bound\n"
+      "STOP, B, 44.98, -93.23, .2\n"
+      "STOP, C, 44.99, -93.21, 0\n";
+  ASSERT_TRUE(cm->ParseConfig(text));
+  mkdir("config", 0755);
+  ASSERT_TRUE(cm->WriteSnapshot("config_manager_UT.snap"));
+
+  // read back through ReadConfig, which spots the snapshot on its own
+  ConfigManager loaded;
+  EXPECT_TRUE(loaded.ReadConfig("config_manager_UT.snap"));
+  remove("config/config_manager_UT.snap");
+  rmdir("config");  // only goes if the test made it
+
+  std::vector<Route *> routes = cm->GetRoutes();
+  std::vector<Route *> loaded_routes = loaded.GetRoutes();
+  ASSERT_EQ(loaded_routes.size(), routes.size());
+  EXPECT_EQ(loaded.GetStops().size(), 3u);
+  for (size_t i = 0; i < routes.size(); i++) {
+    EXPECT_EQ(loaded_routes[i]->GetName(), routes[i]->GetName());
+    ASSERT_EQ(loaded_routes[i]->GetStops().size(),
+              routes[i]->GetStops().size());
+    for (size_t j = 0; j < routes[i]->GetStops().size(); j++) {
+      EXPECT_EQ(loaded_routes[i]->GetStops()[j]->GetId(),
+                routes[i]->GetStops()[j]->GetId());
+    }
+    loaded_routes[i]->NextStop();
+    routes[i]->NextStop();
+    EXPECT_EQ(loaded_routes[i]->GetTotalRouteDistance(),
+              routes[i]->GetTotalRouteDistance());
+  }
+  // the stop shared by both routes is still shared
+  EXPECT_EQ(loaded_routes[0]->GetStops()[1], loaded_routes[1]->GetStops()[0]);
+}
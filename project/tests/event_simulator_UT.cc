@@ -0,0 +1,216 @@
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../src/config_manager.h"
+#include "../src/configuration_simulator.h"
+#include "../src/event_simulator.h"
+#include "../src/route.h"
+#include "../src/stop.h"
+#include "test_networks.h"
+
+/******************************************************
+* TEST FEATURE SetUp
+*******************************************************/
+
+class EventSimulatorTests : public ::testing::Test {
+ protected:
+  std::vector<int> intervals;
+  ConfigManager* tick_cm;
+  ConfigManager* event_cm;
+
+  virtual void SetUp() {
+    intervals.push_back(2);
+
+    // both networks get the same generator streams
+    tick_cm = BuildSeededNetwork(LoopConfig());
+    event_cm = BuildSeededNetwork(LoopConfig());
+  }
+
+  virtual void TearDown() {
+    delete tick_cm;
+    delete event_cm;
+  }
+
+  // stops and passengers report on std::cout, so the whole report is captured
+  std::string TickReport(ConfigurationSimulator* sim) {
+    testing::internal::CaptureStdout();
+    sim->Report(std::cout);
+    return testing::internal::GetCapturedStdout();
+  }
+
+  std::string EventReport(EventSimulator* sim) {
+    testing::internal::CaptureStdout();
+    sim->Report(std::cout);
+    return testing::internal::GetCapturedStdout();
+  }
+
+  // both networks again, from another config
+  void Rebuild(const std::string& config) {
+    delete tick_cm;
+    delete event_cm;
+    tick_cm = BuildSeededNetwork(config);
+    event_cm = BuildSeededNetwork(config);
+  }
+};
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+// every "Wait at Stop" a report lists
+static std::vector<int> WaitsAtStops(const std::string& report) {
+  std::vector<int> waits;
+  const std::string label = "Wait at Stop: ";
+  for (size_t at = report.find(label); at != std::string::npos;
+       at = report.find(label, at + 1)) {
+    waits.push_back(std::atoi(report.c_str() + at + label.size()));
+  }
+  return waits;
+}
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+
+TEST_F(EventSimulatorTests, BussesMatchTickEngine) {
+  // with no one arriving, busses are all there is to compare
+  Rebuild(EmptyLoopConfig());
+  ConfigurationSimulator tick(tick_cm);
+  EventSimulator event(event_cm);
+  tick.SetReportLevel(kReportNone);
+  event.SetReportLevel(kReportNone);
+  tick.Start(intervals, 200);
+  event.Start(intervals, 200);
+
+  // compared at uneven steps so busses are caught between stops too, and
+  // late enough that new busses take the slots of finished ones
+  int checkpoints[] = {1, 3, 10, 11, 25, 60, 133, 200};
+  int time = 0;
+  for (int i = 0; i < 8; i++) {
+    while (time < checkpoints[i]) {
+      tick.Update();
+      time++;
+    }
+    event.RunUntil(time);
+    EXPECT_EQ(event.GetTime(), time);
+    EXPECT_EQ(EventReport(&event), TickReport(&tick)) << "at step " << time;
+  }
+  // a bus starts every third step, far more than are out at the end
+  EXPECT_LT(tick.GetNumBusses(), 30);
+
+  std::ostringstream summary;
+  event.ReportSummary(summary);
+  EXPECT_EQ(summary.str().find("Time 200: " +
+                               std::to_string(tick.GetNumBusses()) +
+                               " busses"), 0u);
+}
+
+TEST_F(EventSimulatorTests, ArrivalsMatchTickEngine) {
+  // no busses, so everyone generated is still waiting
+  intervals.clear();
+  ConfigurationSimulator tick(tick_cm);
+  EventSimulator event(event_cm);
+  tick.SetReportLevel(kReportNone);
+  event.SetReportLevel(kReportNone);
+  tick.Start(intervals, 5000);
+  event.Start(intervals, 5000);
+  for (int i = 0; i < 5000; i++) {
+    tick.Update();
+  }
+  event.RunUntil(5000);
+
+  // the engines draw differently, but every stop should fill as fast
+  const std::vector<Stop *>& tick_stops = tick_cm->GetStops();
+  const std::vector<Stop *>& event_stops = event_cm->GetStops();
+  ASSERT_EQ(tick_stops.size(), event_stops.size());
+  for (int i = 0; i < static_cast<int>(tick_stops.size()); i++) {
+    int expected = tick_stops[i]->GetNumPassengers();
+    ASSERT_GT(expected, 500);
+    EXPECT_NEAR(event_stops[i]->GetNumPassengers(), expected,
+                .1 * expected) << "at stop " << tick_stops[i]->GetId();
+  }
+}
+
+TEST_F(EventSimulatorTests, WaitsAgeBetweenEvents) {
+  intervals.clear();
+  EventSimulator event(event_cm);
+  event.SetReportLevel(kReportNone);
+  event.Start(intervals, 50);
+
+  event.RunUntil(40);
+  std::vector<int> before = WaitsAtStops(EventReport(&event));
+  event.RunUntil(50);
+  std::vector<int> after = WaitsAtStops(EventReport(&event));
+  ASSERT_GT(before.size(), 0u);
+  ASSERT_GT(after.size(), before.size());
+
+  // everyone waited at least the step they arrived in and no longer than
+  // the run, and those already there waited all ten steps in between
+  int sum_before = 0;
+  int sum_after = 0;
+  for (int i = 0; i < static_cast<int>(before.size()); i++) {
+    EXPECT_GE(before[i], 1);
+    EXPECT_LE(before[i], 40);
+    sum_before += before[i];
+  }
+  for (int i = 0; i < static_cast<int>(after.size()); i++) {
+    EXPECT_GE(after[i], 1);
+    EXPECT_LE(after[i], 50);
+    sum_after += after[i];
+  }
+  int num_new = static_cast<int>(after.size() - before.size());
+  int new_waits = sum_after - sum_before - 10 * static_cast<int>(before.size());
+  EXPECT_GE(new_waits, num_new);
+  EXPECT_LE(new_waits, 10 * num_new);
+}
+
+TEST_F(EventSimulatorTests, SummaryCountsSharedStopsOnce) {
+  ConfigurationSimulator tick(tick_cm);
+  EventSimulator event(event_cm);
+  // the tick engine writes its summary line from Update(), the generators
+  // stay quiet since the event engine sets their level last
+  tick.SetReportLevel(kReportSummary);
+  event.SetReportLevel(kReportNone);
+  tick.Start(intervals, 30);
+  event.Start(intervals, 30);
+  for (int i = 0; i < 29; i++) {
+    tick.Update();
+  }
+  testing::internal::CaptureStdout();
+  tick.Update();
+  std::string tick_summary = testing::internal::GetCapturedStdout();
+  event.RunUntil(30);
+
+  // A, C and D are on both routes, so each network's stops are counted by
+  // hand once
+  ConfigManager * networks[] = {tick_cm, event_cm};
+  std::string waiting[2];
+  for (int n = 0; n < 2; n++) {
+    std::set<Stop *> stops;
+    std::vector<Route *> routes = networks[n]->GetRoutes();
+    for (int i = 0; i < static_cast<int>(routes.size()); i++) {
+      const std::vector<Stop *>& route_stops = routes[i]->GetStops();
+      stops.insert(route_stops.begin(), route_stops.end());
+    }
+    ASSERT_EQ(stops.size(), 5u);
+    int num_waiting = 0;
+    for (std::set<Stop *>::iterator it = stops.begin(); it != stops.end();
+         ++it) {
+      num_waiting += (*it)->GetNumPassengers();
+    }
+    ASSERT_GT(num_waiting, 0);
+    waiting[n] = " " + std::to_string(num_waiting) + " waiting,";
+  }
+
+  EXPECT_NE(tick_summary.find(waiting[0]), std::string::npos) << tick_summary;
+  std::ostringstream event_summary;
+  event.ReportSummary(event_summary);
+  EXPECT_NE(event_summary.str().find(waiting[1]), std::string::npos)
+      << event_summary.str();
+}
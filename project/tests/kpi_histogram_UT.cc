@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <cstdint>
+#include "../src/kpi_histogram.h"
+
+/******************************************************
+* TEST FEATURE SetUp
+*******************************************************/
+
+class KpiHistogramTests : public ::testing::Test {
+ protected:
+  KpiHistogram histogram;
+};
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+
+TEST_F(KpiHistogramTests, Empty) {
+  EXPECT_EQ(histogram.GetCount(), 0);
+  EXPECT_EQ(histogram.GetPercentile(50), 0);
+  EXPECT_EQ(histogram.GetMin(), 0);
+  EXPECT_EQ(histogram.GetMax(), 0);
+  EXPECT_DOUBLE_EQ(histogram.GetMean(), 0);
+}
+
+TEST_F(KpiHistogramTests, SmallValuesExact) {
+  for (int i = 1; i <= 20; i++) {
+    histogram.Record(i);
+  }
+  histogram.Record(-4);  // counted as 0
+  EXPECT_EQ(histogram.GetCount(), 21);
+  EXPECT_EQ(histogram.GetMin(), 0);
+  EXPECT_EQ(histogram.GetMax(), 20);
+  EXPECT_DOUBLE_EQ(histogram.GetMean(), 210.0 / 21);
+  EXPECT_EQ(histogram.GetPercentile(50), 10);
+  EXPECT_EQ(histogram.GetPercentile(100), 20);
+  EXPECT_EQ(histogram.GetPercentile(0), 0);
+}
+
+TEST_F(KpiHistogramTests, LargeValuesClose) {
+  for (int64_t i = 1; i <= 100000; i++) {
+    histogram.Record(i);
+  }
+  const double percentiles[] = {10, 50, 90, 99, 99.9};
+  for (double p : percentiles) {
+    double expected = p * 1000;
+    EXPECT_NEAR(histogram.GetPercentile(p), expected, expected * .035) << p;
+  }
+  EXPECT_EQ(histogram.GetPercentile(100), 100000);
+
+  // the largest values still land in a bucket of their own range
+  KpiHistogram huge;
+  huge.Record(INT64_C(1) << 62);
+  EXPECT_EQ(huge.GetPercentile(50), INT64_C(1) << 62);
+}
+
+TEST_F(KpiHistogramTests, Merge) {
+  KpiHistogram other;
+  for (int i = 0; i < 100; i++) {
+    histogram.Record(i);
+    other.Record(1000 + i);
+  }
+  histogram.Merge(other);
+  EXPECT_EQ(histogram.GetCount(), 200);
+  EXPECT_EQ(histogram.GetMin(), 0);
+  EXPECT_EQ(histogram.GetMax(), 1099);
+  EXPECT_NEAR(histogram.GetPercentile(75), 1050, 1050 * .035);
+}
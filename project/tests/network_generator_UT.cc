@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "../src/config_manager.h"
+#include "../src/network_generator.h"
+#include "../src/route.h"
+
+/******************************************************
+* TEST FEATURE SetUp
+*******************************************************/
+
+class NetworkGeneratorTests : public ::testing::Test {
+ protected:
+  NetworkShape shape;
+
+  virtual void SetUp() {
+    shape.num_lines = 3;
+    shape.num_stops = 7;
+  }
+};
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+
+TEST_F(NetworkGeneratorTests, ParsesAsConfig) {
+  ConfigManager cm;
+  EXPECT_TRUE(cm.ParseConfig(NetworkGenerator::Generate(shape)));
+  EXPECT_TRUE(cm.GetErrors().empty());
+
+  std::vector<Route *> routes = cm.GetRoutes();
+  ASSERT_EQ(routes.size(), 6u);
+  EXPECT_EQ(cm.GetStops().size(), 21u);
+  for (int i = 0; i < static_cast<int>(routes.size()); i++) {
+    EXPECT_EQ(routes[i]->GetStops().size(), 7u);
+  }
+  // inbound runs back through the outbound stops
+  EXPECT_EQ(routes[0]->GetStops()[0], routes[1]->GetStops()[6]);
+  EXPECT_EQ(routes[0]->GetStops()[6], routes[1]->GetStops()[0]);
+}
+
+TEST_F(NetworkGeneratorTests, TransfersShared) {
+  shape.transfer_every = 3;
+  ConfigManager cm;
+  EXPECT_TRUE(cm.ParseConfig(NetworkGenerator::Generate(shape)));
+
+  // stops 0, 3 and 6 are listed by all three lines but built once
+  std::vector<Route *> routes = cm.GetRoutes();
+  EXPECT_EQ(cm.GetStops().size(), 3u * 4u + 3u);
+  EXPECT_EQ(routes[0]->GetStops()[3], routes[2]->GetStops()[3]);
+  EXPECT_EQ(routes[0]->GetStops()[3], routes[5]->GetStops()[3]);
+  EXPECT_NE(routes[0]->GetStops()[1], routes[2]->GetStops()[1]);
+}
+
+TEST_F(NetworkGeneratorTests, Reproducible) {
+  std::string text = NetworkGenerator::Generate(shape);
+  EXPECT_EQ(NetworkGenerator::Generate(shape), text);
+  shape.seed = 2;
+  EXPECT_NE(NetworkGenerator::Generate(shape), text);
+}
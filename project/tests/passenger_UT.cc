@@ -13,6 +13,7 @@
  ******************************************************************************/
 #include <gtest/gtest.h>
 #include "../src/passenger.h"
+#include "../src/passenger_name_table.h"
 
 /******************************************************
 * TEST FEATURE SetUp
@@ -127,4 +128,53 @@ TEST_F(PassengerTests, Report) {
 	EXPECT_EQ(output1, expected_out_1);
 	EXPECT_EQ(output2, expected_out_2);
   	EXPECT_EQ(output3, expected_out_3);
-}
\ No newline at end of file
+}
+
+TEST_F(PassengerTests, NameTable) {
+	// generated names are only built from their indices when asked for
+	int generated = PassengerNameTable::Compose(4, 7, 9);
+	EXPECT_LT(generated, PassengerNameTable::kNumGeneratedNames);
+	EXPECT_EQ(PassengerNameTable::GetName(generated), "Bellextraxia");
+
+	// other names are interned once and share an id
+	int zoe = PassengerNameTable::Intern("Zoe");
+	EXPECT_EQ(PassengerNameTable::Intern("Zoe"), zoe);
+	EXPECT_EQ(PassengerNameTable::GetName(zoe), "Zoe");
+
+	Passenger* wash = new Passenger(3, generated);
+
+	std::string expected_out_1 = "Name: Bellextraxia\n"
+  								 "Destination: 3\n"
+  								 "Total Wait: 0\n"
+  								 "\tWait at Stop: 0\n"
+								 "\tTime on bus: 0\n";
+
+	testing::internal::CaptureStdout();
+	wash->Report();
+	std::string output1 = testing::internal::GetCapturedStdout();
+	EXPECT_EQ(output1, expected_out_1);
+	delete wash;
+}
+
+TEST_F(PassengerTests, Clock) {
+	// time is read off the clock of whatever holds the passenger
+	int stop_clock = 4;
+	int bus_clock = 10;
+	passenger->SetClock(&stop_clock);
+	stop_clock += 3;
+	EXPECT_EQ(passenger->GetWaitAtStop(), 3);
+	EXPECT_EQ(passenger->GetTotalWait(), 3);
+
+	passenger->SetClock(&bus_clock);
+	passenger->GetOnBus();
+	stop_clock += 5;
+	bus_clock += 2;
+	EXPECT_EQ(passenger->GetWaitAtStop(), 3);
+	EXPECT_EQ(passenger->GetTimeOnBus(), 3);
+	passenger->Update();
+	EXPECT_EQ(passenger->GetTotalWait(), 7);
+
+	passenger->SetClock(NULL);
+	bus_clock += 2;
+	EXPECT_EQ(passenger->GetTotalWait(), 7);
+}
@@ -0,0 +1,52 @@
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include "../src/passenger.h"
+#include "../src/passenger_name_table.h"
+#include "../src/passenger_pool.h"
+
+/******************************************************
+* TEST FEATURE SetUp
+*******************************************************/
+
+class PassengerPoolTests : public ::testing::Test {
+ protected:
+  Passenger* kevin;
+
+  virtual void SetUp() {
+    kevin = PassengerPool::Acquire(12, PassengerNameTable::Intern("Kevin"));
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+
+TEST_F(PassengerPoolTests, Acquire) {
+  // pooled passenger is constructed like a new one
+  EXPECT_EQ(kevin->GetDestination(), 12);
+  EXPECT_EQ(kevin->GetTotalWait(), 0);
+  EXPECT_FALSE(kevin->IsOnBus());
+  PassengerPool::Release(kevin);
+}
+
+TEST_F(PassengerPoolTests, Release) {
+  int num_free = PassengerPool::GetNumFree();
+  int num_allocated = PassengerPool::GetNumAllocated();
+  Passenger* old_kevin = kevin;
+  PassengerPool::Release(kevin);
+  EXPECT_EQ(PassengerPool::GetNumFree(), num_free + 1);
+
+  // released slot is handed out again before the arena grows
+  Passenger* dan = PassengerPool::Acquire(11,
+                                          PassengerNameTable::Intern("Dan"));
+  EXPECT_EQ(dan, old_kevin);
+  EXPECT_EQ(dan->GetDestination(), 11);
+  EXPECT_EQ(PassengerPool::GetNumFree(), num_free);
+  EXPECT_EQ(PassengerPool::GetNumAllocated(), num_allocated);
+  PassengerPool::Release(dan);
+}
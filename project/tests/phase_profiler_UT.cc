@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../src/config_manager.h"
+#include "../src/configuration_simulator.h"
+#include "../src/phase_profiler.h"
+#include "test_networks.h"
+
+/******************************************************
+* TEST FEATURE SetUp
+*******************************************************/
+
+class PhaseProfilerTests : public ::testing::Test {
+ protected:
+  ConfigManager* cm;
+  ConfigurationSimulator* sim;
+  PhaseProfiler profiler;
+
+  virtual void SetUp() {
+    cm = BuildSeededNetwork(SmallLoopConfig());
+    sim = new ConfigurationSimulator(cm);
+    sim->SetReportLevel(kReportNone);
+    sim->SetProfiler(&profiler);
+  }
+
+  virtual void TearDown() {
+    delete sim;
+    delete cm;
+  }
+};
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+
+TEST_F(PhaseProfilerTests, CountsMatchSimulator) {
+  sim->Start(std::vector<int>(1, 3), 60);
+  for (int i = 0; i < 60; i++) {
+    sim->Update();
+  }
+
+  EXPECT_EQ(profiler.GetNumTicks(), 60);
+  EXPECT_EQ(profiler.GetTotalCount(PhaseProfiler::kGenerated),
+            sim->GetNumGenerated());
+  // a bus every fourth step, starting with the first
+  EXPECT_EQ(profiler.GetTotalCount(PhaseProfiler::kSpawned), 15);
+  EXPECT_EQ(profiler.GetTotalCount(PhaseProfiler::kSpawned) -
+            profiler.GetTotalCount(PhaseProfiler::kRetired),
+            sim->GetNumBusses());
+  EXPECT_GT(profiler.GetTotalCount(PhaseProfiler::kRetired), 0);
+  EXPECT_GE(profiler.GetTotalCount(PhaseProfiler::kBoarded),
+            profiler.GetTotalCount(PhaseProfiler::kAlighted));
+  EXPECT_GT(profiler.GetTotalCount(PhaseProfiler::kAlighted), 0);
+  EXPECT_GT(profiler.GetTotalTime(PhaseProfiler::kBusses), 0);
+}
+
+TEST_F(PhaseProfilerTests, CsvRowPerTick) {
+  std::ostringstream csv;
+  profiler.SetCsv(&csv);
+  sim->Start(std::vector<int>(1, 3), 5);
+  for (int i = 0; i < 5; i++) {
+    sim->Update();
+  }
+
+  std::istringstream lines(csv.str());
+  std::string line;
+  std::getline(lines, line);
+  EXPECT_EQ(line.find("tick,spawn_us,"), 0u);
+  int rows = 0;
+  while (std::getline(lines, line)) {
+    rows++;
+    EXPECT_EQ(line.find(std::to_string(rows) + ","), 0u);
+  }
+  EXPECT_EQ(rows, 5);
+}
+
+TEST_F(PhaseProfilerTests, NullTimerIgnored) {
+  {
+    PhaseProfiler::PhaseTimer timer(NULL, PhaseProfiler::kSpawn);
+  }
+  profiler.BeginTick(1);
+  {
+    PhaseProfiler::PhaseTimer timer(&profiler, PhaseProfiler::kSpawn);
+  }
+  profiler.EndTick();
+  EXPECT_EQ(profiler.GetNumTicks(), 1);
+  EXPECT_GE(profiler.GetTotalTime(PhaseProfiler::kSpawn), 0);
+  EXPECT_EQ(profiler.GetTotalCount(PhaseProfiler::kGenerated), 0);
+}
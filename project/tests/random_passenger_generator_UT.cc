@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <list>
+#include <vector>
+#include "../src/random_passenger_generator.h"
+#include "../src/stop.h"
+
+/******************************************************
+* TEST FEATURE SetUp
+*******************************************************/
+
+class RandomPassengerGeneratorTests : public ::testing::Test {
+ protected:
+  Stop * first;
+  Stop * last;
+  RandomPassengerGenerator * generator;
+
+  virtual void SetUp() {
+    first = new Stop(0);
+    last = new Stop(1);
+    RandomPassengerGenerator::SetMasterSeed(7);
+    generator = new RandomPassengerGenerator(
+        std::list<double>({.35, 0}), std::list<Stop *>({first, last}));
+  }
+
+  virtual void TearDown() {
+    RandomPassengerGenerator::SetBatchSampling(false);
+    delete generator;
+    first->ReleasePassengers();
+    delete first;
+    delete last;
+  }
+
+  // mean passengers per step over many steps, released as they go
+  double MeanArrivals(int steps) {
+    int total = 0;
+    for (int i = 0; i < steps; i++) {
+      total += generator->GeneratePassengers();
+      first->ReleasePassengers();
+    }
+    return static_cast<double>(total) / steps;
+  }
+};
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+// expected count of the trial loop, one term per trial it runs
+static double TrialLoopMean(double probability) {
+  double mean = 0;
+  for (double trial = probability; trial > .0001; trial *= probability) {
+    mean += trial;
+  }
+  return mean;
+}
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+
+TEST_F(RandomPassengerGeneratorTests, ArrivalCdf) {
+  std::vector<double> cdf = RandomPassengerGenerator::BuildArrivalCdf(.35);
+  // eight trials run at .35, so up to eight arrivals
+  ASSERT_EQ(cdf.size(), 9u);
+  EXPECT_NEAR(cdf.back(), 1, 1e-12);
+  double mean = 0;
+  for (int count = 0; count < static_cast<int>(cdf.size()); count++) {
+    if (count > 0) {
+      EXPECT_GE(cdf[count], cdf[count - 1]);
+    }
+    mean += count * (cdf[count] - (count > 0 ? cdf[count - 1] : 0));
+  }
+  EXPECT_NEAR(mean, TrialLoopMean(.35), 1e-12);
+  EXPECT_NEAR(mean, .5383, 1e-4);
+}
+
+TEST_F(RandomPassengerGeneratorTests, ArrivalCdfNeverArrives) {
+  // no trial runs at 0, so no one ever arrives
+  std::vector<double> cdf = RandomPassengerGenerator::BuildArrivalCdf(0);
+  ASSERT_EQ(cdf.size(), 1u);
+  EXPECT_DOUBLE_EQ(cdf[0], 1);
+}
+
+TEST_F(RandomPassengerGeneratorTests, SampleMeans) {
+  // the standard error of 40000 steps is about .003
+  EXPECT_NEAR(MeanArrivals(40000), TrialLoopMean(.35), .015);
+  RandomPassengerGenerator::SetBatchSampling(true);
+  EXPECT_NEAR(MeanArrivals(40000), TrialLoopMean(.35), .015);
+  // nothing is ever generated at the last stop
+  EXPECT_EQ(last->GetNumPassengers(), 0);
+}
+
+TEST_F(RandomPassengerGeneratorTests, NextArrivalMeans) {
+  // skipping from one step with arrivals to the next keeps the same rate
+  int steps = 0;
+  int total = 0;
+  while (steps < 40000) {
+    int gap = generator->StepsToNextArrival(0);
+    ASSERT_GE(gap, 1);
+    steps += gap;
+    int arrivals = generator->GenerateArrivalsAt(0);
+    ASSERT_GE(arrivals, 1);
+    total += arrivals;
+    first->ReleasePassengers();
+  }
+  EXPECT_NEAR(static_cast<double>(total) / steps, TrialLoopMean(.35), .015);
+  // the last stop is never scheduled
+  EXPECT_EQ(generator->StepsToNextArrival(1), 0);
+}
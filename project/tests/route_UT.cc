@@ -100,6 +100,11 @@ TEST_F(RouteTests, Clone) {
   EXPECT_EQ(route->GetName(), clone->GetName());
   EXPECT_EQ(route->GetDestinationStop(), clone->GetDestinationStop());
   EXPECT_EQ(route->GetNextStopDistance(), clone->GetNextStopDistance());
+  // clone shares stops with prototype but moves independently
+  EXPECT_EQ(&route->GetStops(), &clone->GetStops());
+  clone->NextStop();
+  EXPECT_EQ(clone->GetDestinationStop(), stop_2);
+  EXPECT_EQ(route->GetDestinationStop(), stop_1);
 }
 
 TEST_F(RouteTests, Update) {
@@ -120,3 +125,33 @@ TEST_F(RouteTests, RouteData) {
   EXPECT_EQ(route->GetRouteData().stops.at(1).id, std::to_string(stop_2->GetId()));
   EXPECT_EQ(route->GetRouteData().stops.at(1).num_people, stop_2->GetNumPassengers());
 }
+
+TEST_F(RouteTests, RouteDataChanges) {
+  // the struct is built with the route, later updates only touch counts
+  const RouteData& data = route->GetRouteData();
+  EXPECT_EQ(data.stops.at(1).num_people, 1);
+  EXPECT_FALSE(route->UpdateRouteData());
+
+  stop_1->AddPassengers(dan);
+  EXPECT_TRUE(route->UpdateRouteData());
+  EXPECT_EQ(data.stops.at(0).num_people, 1);
+  EXPECT_FALSE(route->UpdateRouteData());
+  EXPECT_EQ(&data, &route->Clone()->GetRouteData());
+}
+
+TEST_F(RouteTests, FindVisit) {
+  // a loop that passes stop 0 twice and ends at stop 2
+  Stop * stop_3 = new Stop(2);
+  Stop * loop_stops[] = {stop_1, stop_2, stop_1, stop_3};
+  double loop_dist[] = {1, 1, 1};
+  Route loop("loop", loop_stops, loop_dist, 4, NULL);
+
+  EXPECT_EQ(loop.FindVisit(0, 0), 0);
+  EXPECT_EQ(loop.FindVisit(0, 1), 2);
+  EXPECT_EQ(loop.FindVisit(1, 0), 1);
+  EXPECT_EQ(loop.FindVisit(1, 2), -1);
+  // the last stop is reached as the next route's first, never stopped at here
+  EXPECT_EQ(loop.FindVisit(2, 0), -1);
+  EXPECT_EQ(loop.FindVisit(99, 0), -1);
+  delete stop_3;
+}
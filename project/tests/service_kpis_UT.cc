@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../src/bus.h"
+#include "../src/config_manager.h"
+#include "../src/configuration_simulator.h"
+#include "../src/passenger_pool.h"
+#include "../src/route.h"
+#include "../src/service_kpis.h"
+#include "../src/stop.h"
+#include "test_networks.h"
+
+/******************************************************
+* TEST FEATURE SetUp
+*******************************************************/
+
+class ServiceKpisTests : public ::testing::Test {
+ protected:
+  ConfigManager* cm;
+  std::vector<Route *> routes;
+  ServiceKpis kpis;
+
+  virtual void SetUp() {
+    cm = BuildSeededNetwork(SmallLoopConfig());
+    routes = cm->GetRoutes();
+  }
+
+  virtual void TearDown() {
+    delete cm;
+  }
+};
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+
+TEST_F(ServiceKpisTests, FullBusDenies) {
+  Stop * a = routes[0]->GetStops()[0];
+  Stop * b = routes[0]->GetStops()[1];
+  for (int i = 0; i < 5; i++) {
+    a->AddPassengers(PassengerPool::Acquire(b->GetId(), 0));
+  }
+  Bus bus("bus", routes[0]->Clone(), routes[1]->Clone(), 2, 1);
+  bus.SetKpis(&kpis);
+
+  EXPECT_TRUE(a->LoadPassengers(&bus));
+  EXPECT_EQ(a->GetNumDenied(), 3);
+  EXPECT_EQ(kpis.GetWaitAtStop().GetCount(), 2);
+  EXPECT_EQ(ServiceKpis::GetNumDenied(cm->GetStops()), 3);
+
+  EXPECT_TRUE(bus.UnloadPassengers(b));
+  EXPECT_EQ(kpis.GetRideTime().GetCount(), 2);
+  bus.Reclaim();
+
+  std::ostringstream out;
+  kpis.ReportSummary(out, cm->GetStops());
+  EXPECT_NE(out.str().find("Denied boardings: 3"), std::string::npos);
+  EXPECT_NE(out.str().find("Stop " + std::to_string(a->GetId()) + ": 3"),
+            std::string::npos);
+}
+
+TEST_F(ServiceKpisTests, MatchesSimulatorCounts) {
+  ConfigurationSimulator sim(cm);
+  PhaseProfiler profiler;
+  sim.SetReportLevel(kReportNone);
+  sim.SetProfiler(&profiler);
+  sim.SetKpis(&kpis);
+  sim.Start(std::vector<int>(1, 3), 80);
+  for (int i = 0; i < 80; i++) {
+    sim.Update();
+  }
+
+  EXPECT_EQ(kpis.GetWaitAtStop().GetCount(),
+            profiler.GetTotalCount(PhaseProfiler::kBoarded));
+  EXPECT_EQ(kpis.GetRideTime().GetCount(),
+            profiler.GetTotalCount(PhaseProfiler::kAlighted));
+  EXPECT_EQ(kpis.GetBusLoad().GetCount(),
+            profiler.GetTotalCount(PhaseProfiler::kRetired));
+  EXPECT_GT(kpis.GetRideTime().GetCount(), 0);
+  EXPECT_GT(kpis.GetRideTime().GetMin(), 0);
+  EXPECT_LE(kpis.GetBusLoad().GetMax(), 100);
+}
+
+TEST_F(ServiceKpisTests, Merge) {
+  ServiceKpis other;
+  kpis.RecordBoarding(4);
+  other.RecordBoarding(8);
+  other.RecordAlighting(3);
+  other.RecordBus(.5);
+  kpis.Merge(other);
+  EXPECT_EQ(kpis.GetWaitAtStop().GetCount(), 2);
+  EXPECT_DOUBLE_EQ(kpis.GetWaitAtStop().GetMean(), 6);
+  EXPECT_EQ(kpis.GetRideTime().GetCount(), 1);
+  EXPECT_EQ(kpis.GetBusLoad().GetMax(), 50);
+}
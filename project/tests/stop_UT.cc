@@ -139,3 +139,26 @@ TEST_F(StopTests, Update) {
   EXPECT_EQ(dan->GetTotalWait(), 1);
   EXPECT_EQ(kevin->GetTotalWait(), 2);
 }
+
+TEST_F(StopTests, SharedStop) {
+  Passenger* kevin = new Passenger(12, "Kevin");
+  Passenger* dan = new Passenger(11, "Dan");
+  // stop_out_1 already belongs to "outgoing", a second route gets a new queue
+  EXPECT_EQ(stop_out_1->AddRoute("outgoing"), 0);
+  int other = stop_out_1->AddRoute("other");
+  EXPECT_EQ(other, 1);
+  stop_out_1->AddPassengers(kevin, other);
+  stop_out_1->AddPassengers(dan);
+  EXPECT_EQ(stop_out_1->GetNumPassengers(), 2);
+
+  // each route only updates its own passengers
+  stop_out_1->Update(other);
+  EXPECT_EQ(kevin->GetTotalWait(), 1);
+  EXPECT_EQ(dan->GetTotalWait(), 0);
+
+  // and a bus only boards passengers waiting for its route
+  EXPECT_TRUE(stop_out_1->LoadPassengers(bus, 0));
+  EXPECT_TRUE(dan->IsOnBus());
+  EXPECT_FALSE(kevin->IsOnBus());
+  EXPECT_EQ(stop_out_1->GetNumPassengers(), 1);
+}
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../src/network_generator.h"
+#include "../src/sweep_runner.h"
+
+/******************************************************
+* TEST FEATURE SetUp
+*******************************************************/
+
+class SweepRunnerTests : public ::testing::Test {
+ protected:
+  SweepRunner runner;
+};
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+// drops the seconds column, the only one that changes between runs
+static std::string WithoutSeconds(const std::string& csv) {
+  std::istringstream lines(csv);
+  std::string line;
+  std::string kept;
+  while (std::getline(lines, line)) {
+    std::vector<std::string> fields;
+    std::istringstream in(line);
+    std::string field;
+    while (std::getline(in, field, ',')) {
+      fields.push_back(field);
+    }
+    fields.erase(fields.begin() + 7);
+    for (size_t i = 0; i < fields.size(); i++) {
+      kept += fields[i] + (i + 1 < fields.size() ? "," : "\n");
+    }
+  }
+  return kept;
+}
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+
+TEST_F(SweepRunnerTests, Expansion) {
+  EXPECT_TRUE(runner.ParseGrid("# two by three by two\n"
+                               "CONFIG, a.txt, b.txt\n"
+                               "INTERVAL, 5, 3/8, 10\n"
+                               "SEED, 1, 2\n"));
+  const std::vector<Scenario>& scenarios = runner.GetScenarios();
+  ASSERT_EQ(scenarios.size(), 12u);
+
+  // seed changes fastest, config slowest
+  EXPECT_EQ(scenarios[0].config, "a.txt");
+  EXPECT_EQ(scenarios[0].seed, 1u);
+  EXPECT_EQ(scenarios[1].seed, 2u);
+  EXPECT_EQ(scenarios[2].intervals, std::vector<int>({3, 8}));
+  EXPECT_EQ(scenarios[6].config, "b.txt");
+  EXPECT_EQ(scenarios[11].intervals, std::vector<int>(1, 10));
+
+  // rows left out keep the defaults
+  EXPECT_EQ(scenarios[0].capacity, Scenario().capacity);
+  EXPECT_EQ(scenarios[0].rounds, Scenario().rounds);
+}
+
+TEST_F(SweepRunnerTests, Errors) {
+  EXPECT_FALSE(runner.ParseGrid("INTERVAL, 5\n"));
+  EXPECT_FALSE(runner.ParseGrid("CONFIG, a.txt\nCAPACITY, 40, x\n", "g"));
+  EXPECT_FALSE(runner.ParseGrid("CONFIG, a.txt\nINTERVAL, 3/0\n"));
+  EXPECT_FALSE(runner.ParseGrid("CONFIG, a.txt\nSPEEED, 1\n"));
+  EXPECT_TRUE(runner.GetScenarios().empty());
+
+  ASSERT_EQ(runner.GetErrors().size(), 4u);
+  EXPECT_EQ(runner.GetErrors()[1], "g:2: CAPACITY has a bad value x");
+
+  Scenario missing;
+  missing.config = "sweep_runner_UT_missing.txt";
+  runner.AddScenario(missing);
+  std::ostringstream out;
+  EXPECT_FALSE(runner.Run(out, 1));
+  EXPECT_TRUE(out.str().empty());
+}
+
+TEST_F(SweepRunnerTests, SameRowsOnAnyThreads) {
+  NetworkShape shape;
+  shape.num_lines = 2;
+  shape.num_stops = 6;
+  mkdir("config", 0755);
+  ASSERT_TRUE(NetworkGenerator::Write("sweep_runner_UT.txt", shape));
+  ASSERT_TRUE(runner.ParseGrid("CONFIG, sweep_runner_UT.txt\n"
+                               "INTERVAL, 2, 3/6\n"
+                               "CAPACITY, 2, 30\n"
+                               "ROUNDS, 60\n"
+                               "SEED, 1, 7\n"));
+
+  std::ostringstream serial;
+  std::ostringstream parallel;
+  EXPECT_TRUE(runner.Run(serial, 1));
+  EXPECT_TRUE(runner.Run(parallel, 4));
+  remove("config/sweep_runner_UT.txt");
+  rmdir("config");  // only goes if the test made it
+
+  std::string rows = WithoutSeconds(serial.str());
+  EXPECT_EQ(WithoutSeconds(parallel.str()), rows);
+  // header and one row per scenario, in grid order
+  EXPECT_EQ(std::count(rows.begin(), rows.end(), '\n'), 9);
+  EXPECT_NE(rows.find("\n0,sweep_runner_UT.txt,2,2,1,1,60,"),
+            std::string::npos);
+  EXPECT_NE(rows.find("\n7,sweep_runner_UT.txt,3/6,30,1,7,60,"),
+            std::string::npos);
+}
+
+TEST_F(SweepRunnerTests, LongRowsKeptWhole) {
+  NetworkShape shape;
+  shape.num_stops = 4;
+  mkdir("config", 0755);
+  ASSERT_TRUE(NetworkGenerator::Write("sweep_runner_UT.txt", shape));
+  // intervals past the network's last pair are still written, so 300 of
+  // them make rows of over 600 characters
+  std::string intervals = "INTERVAL, 5";
+  for (int i = 1; i < 300; i++) {
+    intervals += "/5";
+  }
+  ASSERT_TRUE(runner.ParseGrid("CONFIG, sweep_runner_UT.txt\n" + intervals +
+                               "\nROUNDS, 10\nSEED, 1, 2\n"));
+
+  std::ostringstream out;
+  EXPECT_TRUE(runner.Run(out, 2));
+  remove("config/sweep_runner_UT.txt");
+  rmdir("config");  // only goes if the test made it
+
+  std::istringstream lines(out.str());
+  std::string line;
+  std::getline(lines, line);
+  int num_columns = std::count(line.begin(), line.end(), ',') + 1;
+  for (int i = 0; i < 2; i++) {
+    ASSERT_TRUE(static_cast<bool>(std::getline(lines, line)));
+    EXPECT_GT(line.size(), 600u);
+    EXPECT_EQ(line.find(std::to_string(i) + ","), 0u);
+    EXPECT_EQ(std::count(line.begin(), line.end(), ',') + 1, num_columns);
+  }
+  EXPECT_FALSE(static_cast<bool>(std::getline(lines, line)));
+}
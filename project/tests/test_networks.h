@@ -0,0 +1,66 @@
+#ifndef TESTS_TEST_NETWORKS_H_
+#define TESTS_TEST_NETWORKS_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+#include "../src/config_manager.h"
+#include "../src/random_passenger_generator.h"
+
+/*******************************************************************************
+ * Shared Networks
+ ******************************************************************************/
+
+// East Bound A, B, C and West Bound C, A, so A and C are shared
+inline std::string SmallLoopConfig() {
+  return "ROUTE_GENERAL, Loop\n"
+         "ROUTE, East Bound\n"
+         "STOP, A, 44.9730, -93.2354, .3\n"
+         "STOP, B, 44.9750, -93.2300, .2\n"
+         "STOP, C, 44.9800, -93.2250, 0\n"
+         "ROUTE, West Bound\n"
+         "STOP, C, 44.9800, -93.2250, .3\n"
+         "STOP, A, 44.9730, -93.2354, 0\n";
+}
+
+// East Bound A, B, C, D and West Bound D, C, E, A, so A, C and D are shared
+inline std::string LoopConfig() {
+  return "ROUTE_GENERAL, Loop\n"
+         "ROUTE, East Bound\n"
+         "STOP, A, 44.9730, -93.2354, .3\n"
+         "STOP, B, 44.9750, -93.2300, .2\n"
+         "STOP, C, 44.9800, -93.2250, .1\n"
+         "STOP, D, 44.9820, -93.2200, 0\n"
+         "ROUTE, West Bound\n"
+         "STOP, D, 44.9820, -93.2200, .3\n"
+         "STOP, C, 44.9800, -93.2250, .2\n"
+         "STOP, E, 44.9760, -93.2320, .1\n"
+         "STOP, A, 44.9730, -93.2354, 0\n";
+}
+
+// LoopConfig with no one arriving, so a run depends only on the busses
+inline std::string EmptyLoopConfig() {
+  return "ROUTE_GENERAL, Loop\n"
+         "ROUTE, East Bound\n"
+         "STOP, A, 44.9730, -93.2354, 0\n"
+         "STOP, B, 44.9750, -93.2300, 0\n"
+         "STOP, C, 44.9800, -93.2250, 0\n"
+         "STOP, D, 44.9820, -93.2200, 0\n"
+         "ROUTE, West Bound\n"
+         "STOP, D, 44.9820, -93.2200, 0\n"
+         "STOP, C, 44.9800, -93.2250, 0\n"
+         "STOP, E, 44.9760, -93.2320, 0\n"
+         "STOP, A, 44.9730, -93.2354, 0\n";
+}
+
+// parses config with the generators seeded the same way every time, so two
+// networks built from one config generate the same passengers
+inline ConfigManager * BuildSeededNetwork(const std::string& config) {
+  RandomPassengerGenerator::SetMasterSeed(7);
+  ConfigManager * cm = new ConfigManager();
+  cm->ParseConfig(config);
+  return cm;
+}
+
+#endif  // TESTS_TEST_NETWORKS_H_
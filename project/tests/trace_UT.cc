@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include "../src/passenger.h"
+#include "../src/stop.h"
+#include "../src/trace_reader.h"
+#include "../src/trace_writer.h"
+
+/******************************************************
+* TEST FEATURE SetUp
+*******************************************************/
+
+class TraceTests : public ::testing::Test {
+ protected:
+  std::string filename;
+  Stop* stop;
+  Passenger* kevin;
+
+  virtual void SetUp() {
+    filename = "trace_UT.bin";
+    stop = new Stop(3);
+    kevin = new Passenger(5, "Kevin");
+    stop->AddPassengers(kevin);
+  }
+
+  virtual void TearDown() {
+    delete stop;
+    delete kevin;
+    remove(filename.c_str());
+  }
+};
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+
+TEST_F(TraceTests, RoundTrip) {
+  // tiny buffer so records straddle several writes
+  TraceWriter* trace = new TraceWriter(filename, 16);
+  ASSERT_TRUE(trace->IsOpen());
+  trace->WriteText("start\n");
+  trace->WriteTick(2);
+  stop->Trace(trace);
+  delete trace;
+
+  std::ostringstream text;
+  EXPECT_TRUE(TraceReader::ToText(filename, text));
+  EXPECT_EQ(text.str(),
+            "start\n"
+            "~~~~~~~~~~~~~ The time is now 2 ~~~~~~~~~~~~~\n"
+            "ID: 3\n"
+            "Passengers waiting: 1\n"
+            "Name: Kevin\n"
+            "Destination: 5\n"
+            "Total Wait: 0\n"
+            "\tWait at Stop: 0\n"
+            "\tTime on bus: 0\n");
+}
+
+TEST_F(TraceTests, Truncated) {
+  std::ostringstream text;
+  std::istringstream not_trace("plain text");
+  EXPECT_FALSE(TraceReader::ToText(not_trace, text));
+
+  TraceWriter* trace = new TraceWriter(filename);
+  trace->WriteTick(1);
+  trace->Flush();
+  std::ifstream whole(filename.c_str(), std::ios::binary);
+  std::string bytes((std::istreambuf_iterator<char>(whole)),
+                    std::istreambuf_iterator<char>());
+  delete trace;
+
+  // dropping the last byte cuts the tick record short
+  std::istringstream cut(bytes.substr(0, bytes.size() - 1));
+  EXPECT_FALSE(TraceReader::ToText(cut, text));
+}
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <string>
+#include "../src/data_structs.h"
+#include "../src/local_simulator.h"
+#include "../src/visualizer_delta.h"
+
+/******************************************************
+* TEST FEATURE SetUp
+*******************************************************/
+
+class VisualizerDeltaTests : public ::testing::Test {
+ protected:
+  VisualizerDelta* delta;
+  RouteData route;
+
+  virtual void SetUp() {
+    delta = new VisualizerDelta();
+    route.id = "East";
+    route.stops.resize(2);
+    route.stops[0].id = "10";
+    route.stops[0].position.x = 1.5;
+    route.stops[0].position.y = 2;
+    route.stops[1].id = "11";
+    route.stops[1].num_people = 3;
+  }
+
+  virtual void TearDown() {
+    delete delta;
+  }
+
+  BusData MakeBus(std::string id, float x, int passengers) {
+    BusData bus;
+    bus.id = id;
+    bus.position.x = x;
+    bus.num_passengers = passengers;
+    bus.capacity = 60;
+    return bus;
+  }
+};
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+
+TEST_F(VisualizerDeltaTests, Busses) {
+  delta->UpdateBus(MakeBus("1000", 1, 0));
+  delta->UpdateBus(MakeBus("1001", 2, 5));
+  EXPECT_EQ(delta->GetBusses(-1),
+            "{\"command\":\"updateBusses\",\"version\":2,\"delta\":0,"
+            "\"busses\":[[\"1000\",1,0,0,60],[\"1001\",2,0,5,60]]}");
+
+  // only the bus that moved and the one that left are sent
+  delta->UpdateBus(MakeBus("1000", 1, 0));
+  delta->UpdateBus(MakeBus("1001", 2.25, 5));
+  delta->UpdateBus(MakeBus("1000", 1, 0), true);
+  EXPECT_EQ(delta->GetBusses(2),
+            "{\"command\":\"updateBusses\",\"version\":4,\"delta\":1,"
+            "\"busses\":[[\"1001\",2.25,0,5,60]],\"removed\":[\"1000\"]}");
+  EXPECT_EQ(delta->GetBusses(4),
+            "{\"command\":\"updateBusses\",\"version\":4,\"delta\":1,"
+            "\"busses\":[],\"removed\":[]}");
+}
+
+TEST_F(VisualizerDeltaTests, ChangesAfterARequestAreKept) {
+  delta->UpdateBus(MakeBus("1000", 1, 0));
+  delta->UpdateBus(MakeBus("1001", 2, 5));
+  int version = delta->GetVersion();
+  delta->GetBusses(version);
+
+  // the same step goes on after the request, and the next one sees it
+  delta->UpdateBus(MakeBus("1001", 3, 5));
+  EXPECT_EQ(delta->GetBusses(version),
+            "{\"command\":\"updateBusses\",\"version\":3,\"delta\":1,"
+            "\"busses\":[[\"1001\",3,0,5,60]],\"removed\":[]}");
+
+  // a version this delta never gave out, say from before a restart
+  EXPECT_NE(delta->GetBusses(7).find("\"delta\":0"), std::string::npos);
+  EXPECT_NE(delta->GetRoutes(7).find("\"delta\":0"), std::string::npos);
+}
+
+TEST_F(VisualizerDeltaTests, Routes) {
+  delta->UpdateRoute(route);
+  EXPECT_EQ(delta->GetRoutes(-1),
+            "{\"command\":\"updateRoutes\",\"version\":1,\"delta\":0,"
+            "\"stops\":[[\"10\",1.5,2,0],[\"11\",0,0,3]],\"counts\":[],"
+            "\"routes\":[[\"East\",[\"10\",\"11\"]]]}");
+
+  // a new route sharing stop 11 adds only its new stop
+  route.stops[1].num_people = 4;
+  delta->UpdateRoute(route);
+  RouteData west;
+  west.id = "West";
+  west.stops.push_back(route.stops[1]);
+  west.stops.push_back(StopData());
+  west.stops[1].id = "12";
+  delta->UpdateRoute(west);
+  EXPECT_EQ(delta->GetRoutes(1),
+            "{\"command\":\"updateRoutes\",\"version\":3,\"delta\":1,"
+            "\"stops\":[[\"12\",0,0,0]],\"counts\":[[\"11\",4]],"
+            "\"routes\":[[\"West\",[\"11\",\"12\"]]]}");
+}
+
+TEST_F(VisualizerDeltaTests, FedByLocalSimulator) {
+  LocalSimulator sim;
+  sim.SetReportLevel(kReportNone);
+  sim.SetWebInterface(delta);
+  sim.Start();
+  std::string routes = delta->GetRoutes(-1);
+  EXPECT_NE(routes.find("\"Campus Connector - Eastbound\""), std::string::npos);
+  EXPECT_NE(routes.find("\"Campus Connector - Westbound\""), std::string::npos);
+  EXPECT_NE(delta->GetBusses(-1).find("\"busses\":[]"), std::string::npos);
+
+  // the first bus leaves once its ten step countdown runs out, and is on
+  // its way along the first leg ten steps later
+  for (int i = 0; i < 11; i++) {
+    sim.Update();
+  }
+  int version = delta->GetVersion();
+  EXPECT_NE(delta->GetBusses(-1).find("[\"10000\","), std::string::npos);
+  for (int i = 0; i < 10; i++) {
+    sim.Update();
+  }
+  EXPECT_GT(delta->GetVersion(), version);
+  std::string busses = delta->GetBusses(version);
+  EXPECT_NE(busses.find("\"delta\":1"), std::string::npos);
+  EXPECT_NE(busses.find("[\"10000\","), std::string::npos) << busses;
+}
@@ -20,6 +20,13 @@ var busses = [];
 var stops = [];
 var routes = [];
 
+// Delta mode: the version of the last update applied is sent back with each
+// request, and a server that supports it answers with only what changed
+var lastBusVersion = -1;
+var lastRouteVersion = -1;
+var busIndex = {}; // bus id -> index in busses
+var stopIndex = {}; // stop id -> index in stops
+
 var numRoutes;
 var busTimeOffsetsSliders = [];
 var busTimeOffsets = [];
@@ -74,7 +81,9 @@ function setupSocket() {
                 numRoutes = int(data.numRoutes / 2);
                 initRouteSliders();
             }
-            if (data.command == "updateBusses") {
+            if (data.command == "updateBusses" && data.version !== undefined) {
+                applyBusDelta(data);
+            } else if (data.command == "updateBusses") {
                 
                 busses = [];
 
@@ -90,7 +99,9 @@ function setupSocket() {
                     busses.push(new Bus(id, position, numPassengers, capacity));
                 }
             }
-            if (data.command == "updateRoutes") {
+            if (data.command == "updateRoutes" && data.version !== undefined) {
+                applyRouteDelta(data);
+            } else if (data.command == "updateRoutes") {
                 
                 routes = [];
                 
@@ -102,14 +113,15 @@ function setupSocket() {
                     for (let j = 0; j < data.routes[i].stops.length; j++) {
                         stop_id = data.routes[i].stops[j].id;
                         
-                        let index = stops.findIndex(x => x.id == stop_id);
-                        if (index == -1) {
+                        let index = stopIndex[stop_id];
+                        if (index === undefined) {
                             numPeople = data.routes[i].stops[j].numPeople;
 
                             x = data.routes[i].stops[j].position.x;
                             y = data.routes[i].stops[j].position.y;
                             position = new Position(x, y);
 
+                            stopIndex[stop_id] = stops.length;
                             stops.push(new Stop(stop_id, position, numPeople));
 
                             route_stop_indices.push(stops.length-1);
@@ -135,6 +147,78 @@ function setupSocket() {
     }
 }
 
+// Busses come as [id, x, y, numPassengers, capacity]. A full update
+// ("delta": 0) replaces every bus, otherwise busses not listed are unchanged.
+function applyBusDelta(data) {
+    if (!data.delta) {
+        busses = [];
+        busIndex = {};
+    }
+    for (let i = 0; data.removed && i < data.removed.length; i++) {
+        let index = busIndex[data.removed[i]];
+        if (index === undefined) {
+            continue;
+        }
+        // move the last bus into the hole
+        let last = busses.pop();
+        if (index < busses.length) {
+            busses[index] = last;
+            busIndex[last.id] = index;
+        }
+        delete busIndex[data.removed[i]];
+    }
+    for (let i = 0; i < data.busses.length; i++) {
+        let b = data.busses[i];
+        let bus = new Bus(b[0], new Position(b[1], b[2]), b[3], b[4]);
+        bus.numPassengers = b[3]; // Bus() misspells its parameter
+        if (busIndex[b[0]] === undefined) {
+            busIndex[b[0]] = busses.length;
+            busses.push(bus);
+        } else {
+            busses[busIndex[b[0]]] = bus;
+        }
+    }
+    lastBusVersion = data.version;
+}
+
+// New stops come as [id, x, y, numPeople], changed counts of known stops
+// as [id, numPeople] and new routes as [id, [stop ids]].
+function applyRouteDelta(data) {
+    if (!data.delta) {
+        stops = [];
+        stopIndex = {};
+        routes = [];
+    }
+    // stops are looked up by id, so each update costs what it lists
+    for (let i = 0; i < data.stops.length; i++) {
+        let s = data.stops[i];
+        let stop = new Stop(s[0], new Position(s[1], s[2]), s[3]);
+        if (stopIndex[s[0]] === undefined) {
+            stopIndex[s[0]] = stops.length;
+            stops.push(stop);
+        } else {
+            stops[stopIndex[s[0]]] = stop;
+        }
+    }
+    for (let i = 0; i < data.counts.length; i++) {
+        let index = stopIndex[data.counts[i][0]];
+        if (index !== undefined) {
+            stops[index].numPeople = data.counts[i][1];
+        }
+    }
+    for (let i = 0; i < data.routes.length; i++) {
+        let r = data.routes[i];
+        let indices = r[1].map(id => stopIndex[id] === undefined ? -1 : stopIndex[id]);
+        let index = routes.findIndex(x => x.id == r[0]);
+        if (index == -1) {
+            routes.push(new Route(r[0], indices));
+        } else {
+            routes[index] = new Route(r[0], indices);
+        }
+    }
+    lastRouteVersion = data.version;
+}
+
 
 
 
@@ -147,6 +231,7 @@ function setup() {
     
     busses = [];
     stops  = [];
+    stopIndex = {};
     routes = [];
     
     canvas = createCanvas(windowWidth, windowHeight);
@@ -192,8 +277,8 @@ function draw() {
 
 function update() {
 	// Send down commands to C++
-	socket.send(JSON.stringify({command: "getRoutes"}));
-	socket.send(JSON.stringify({command: "getBusses"}));
+	socket.send(JSON.stringify({command: "getRoutes", since: lastRouteVersion}));
+	socket.send(JSON.stringify({command: "getBusses", since: lastBusVersion}));
 
 	// Only update every specified timestep
     elapsedTime = millis() - startTime;